@@ -10,5 +10,8 @@
 #define SCALE 0.25
 
 #include "penguin/ping.sou"
+#ifdef ACTOR_LOD
+#include "actors/penguin/ping.lod.inc.c"
+#endif
 #include "penguin/collision.inc.c"
 UNUSED static const u64 binid_1 = 1;
@@ -8,4 +8,8 @@
 #include "common1.h"
 #include "group7.h"
 
+#ifdef ACTOR_LOD
+#include "actors/penguin/ping.lod.hms"
+#else
 #include "penguin/ping.hms"
+#endif
@@ -21,5 +21,113 @@
 
 // Debug Build
 #define DEBUG
+// Time every cur_obj_update() call and aggregate the results per behavior.
+// Toggled in game with L on controller 3 (see behavior_profiler.c).
+#define BEHAVIOR_PROFILER
+// Track the graphics pool high-water marks and report display list overflows
+// with the graph node that caused them (see profile_gfx_pool in game_init.c)
+#define GFX_POOL_PROFILER
+
+// Object Pool Defines
+// Number of object slots in the static object pool (vanilla: 240)
+#define OBJECT_POOL_CAPACITY 240
+// Allow levels to reserve extra object slots in a second slab allocated on level load.
+// See sObjectPoolReservations in object_list_processor.c.
+#define OBJECT_POOL_RESERVATIONS
+// Number of lightweight particles that can be alive at once, their buffer is taken from
+// the main pool on level load (see particle_system.c)
+#define PARTICLE_POOL_CAPACITY 128
+
+// Let far-away objects of opted-in behaviors tick at a reduced rate or sleep.
+// See sObjectSleepRules in object_list_processor.c.
+#define OBJECT_SLEEP_SCHEDULING
+
+// While time is stopped, only visit the objects that can be unfrozen (Mario, doors,
+// unimportant objects and time stop initiators) instead of walking every object list
+#define TIME_STOP_EXEMPT_LIST
+
+// Rendering Defines
+// Gfx commands in each of the two graphics pools (vanilla: 6400). With
+// GFX_POOL_PROFILER the debug text shows the measured peak ("PEAK") and a
+// size with some headroom on top of it ("FIT") to set this to.
+#define GFX_POOL_SIZE 6400
+// Sort the display lists of opaque master list layers by texture and combiner
+// to reduce RDP state changes (see rendering_graph_node.c)
+#define MASTER_LIST_SORTING
+
+// Cull objects against all six planes of the view frustum, and cull display list
+// nodes (and their subtrees) against bounding spheres computed on geo layout load
+#define FRUSTUM_CULLING
+
+// Replace graph subtrees made only of display list and fixed transform nodes with
+// a flat array of display lists and premultiplied matrices on geo layout load
+#define FLATTEN_STATIC_GEO
+
+// Reuse last frame's fixed point matrix for transform nodes whose parent matrix
+// and local parameters have not changed
+#define MTX_CACHE
+// Number of transforms the matrix cache can hold (must be a power of 2), about 270
+// bytes each, taken from the main pool on level load
+#define MTX_CACHE_SIZE 128
+// Decode each frame of an animation once per frame and share it between the
+// objects playing it
+#define ANIM_DECODE_CACHE
+// Number of animation frames the decode cache can tell apart (must be a power of 2)
+#define ANIM_DECODE_CACHE_SIZE 64
+// Joints per animation kept in the decode cache, later joints are decoded directly
+#define ANIM_DECODE_MAX_JOINTS 40
+// Draw simplified meshes of the models listed in actors/lod.json when they are far
+// away (see tools/lod_generator.py)
+#define ACTOR_LOD
+// Draw the skybox from static tile vertices and skip the tiles that are off screen
+// (see skybox.c)
+#define SKYBOX_STATIC_TILES
+// Keep rippling painting meshes between frames and only update the vertices and
+// normals that the ripple moved (see painting_update_ripple_mesh in paintings.c)
+#define PAINTING_INCREMENTAL_RIPPLE
+// How far a painting vertex must move before it and its normals are updated
+#define PAINTING_RIPPLE_THRESHOLD 1
+// Keep moving texture vertices between frames and only update their texture
+// coordinates (see movtex_select_buffer in moving_texture.c)
+#define MOVTEX_RESIDENT_VTX
+// Number of water quads that can keep their vertices, must be a power of two
+#define MOVTEX_QUAD_BUFFERS 16
+// Environment effect particle budget, normal snow in CCM and SL builds up to this many
+// snowflakes (vanilla: 140, at least 60 for jet stream bubbles)
+#define ENVFX_MAX_PARTICLES 140
+// Keep shadow meshes between frames and only rebuild them when the object or the
+// dynamic surfaces below it move (see create_shadow_below_xyz in shadow.c)
+#define SHADOW_CACHE
+// Number of objects that can keep their shadow, must be a power of two; the cache is
+// taken from the main pool on level load
+#define SHADOW_CACHE_SIZE 32
+// Draw the colorful HUD and debug text grouped by glyph, loading each glyph's texture
+// once per frame instead of once per character (see render_text_labels in print.c)
+#define TEXT_GLYPH_BATCHING
+// Compile the text of an open dialog page into a display list once and replay it until
+// the page changes (see render_dialog_page_text in ingame_menu.c)
+#define DIALOG_PAGE_CACHE
+// Bytes taken from the main pool for the compiled page while a dialog is open, a full
+// 6 line page takes about 16 KB
+#define DIALOG_PAGE_CACHE_SIZE 0x4000
+// Start the next frame's game logic as soon as a buffer swap is requested instead of
+// waiting for the swap to happen; frames stay capped at 30 FPS (see display_and_vsync
+// in game_init.c). Comment out for the vanilla pacing.
+#define FRAME_PACING_DECOUPLED
+// Run SP tasks from a queue ordered by priority and deadline: audio, then gfx, then
+// other compute tasks (see schedule_sptasks in main.c)
+#define SPTASK_SCHEDULER
+// Number of SP tasks that can wait for the RSP at once
+#define SPTASK_QUEUE_SIZE 8
+// Convert billboard matrices to fixed point by writing only their roll, scale and
+// translation entries, and draw particles that share a display list back to back
+// (see mtxf_billboard_to_mtx in math_util.c)
+#define FAST_BILLBOARD_MTX
+
+// Behavior Script Defines
+// Decode each behavior script once per level and run the decoded form with a tighter interpreter loop
+#define BHV_SCRIPT_PREDECODE
+// Bytes reserved on level load for decoded behavior scripts (see behavior_script.c)
+#define BHV_DECODE_CACHE_SIZE 0x5000
 
 #endif // CONFIG_H
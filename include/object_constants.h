@@ -17,6 +17,7 @@
 #define ACTIVE_FLAG_UNK8                   (1 <<  8) // 0x0100
 #define ACTIVE_FLAG_UNK9                   (1 <<  9) // 0x0200
 #define ACTIVE_FLAG_UNK10                  (1 << 10) // 0x0400
+#define ACTIVE_FLAG_SLEEPING               (1 << 11) // 0x0800
 
 /* respawnInfoType */
 #define RESPAWN_INFO_TYPE_NULL 0
@@ -2,7 +2,7 @@
 #define OBJECT_FIELDS_H
 
 /**
- * The array [0x88, 0x1C8) in struct Object consists of fields that can vary by
+ * The array [0xB4, 0x1F4) in struct Object consists of fields that can vary by
  * object type. These macros provide access to these fields.
  */
 
@@ -48,1094 +48,1095 @@
 #endif
 #endif
 
-// 0x088 (0x00), the first field, is object-specific and defined below the common fields.
+// 0x0B4 (0x00), the first field, is object-specific and defined below the common fields.
 /* Common fields */
-#define /*0x08C*/ oFlags                      OBJECT_FIELD_U32(0x01)
-#define /*0x090*/ oDialogResponse             OBJECT_FIELD_S16(0x02, 0)
-#define /*0x092*/ oDialogState                OBJECT_FIELD_S16(0x02, 1)
-#define /*0x094*/ oUnk94                      OBJECT_FIELD_U32(0x03)
-// 0x98 unused/removed.
-#define /*0x09C*/ oIntangibleTimer            OBJECT_FIELD_S32(0x05)
-#define /*0x0A0*/ O_POS_INDEX                 0x06
-#define /*0x0A0*/ oPosX                       OBJECT_FIELD_F32(O_POS_INDEX + 0)
-#define /*0x0A4*/ oPosY                       OBJECT_FIELD_F32(O_POS_INDEX + 1)
-#define /*0x0A8*/ oPosZ                       OBJECT_FIELD_F32(O_POS_INDEX + 2)
-#define /*0x0AC*/ oVelX                       OBJECT_FIELD_F32(0x09)
-#define /*0x0B0*/ oVelY                       OBJECT_FIELD_F32(0x0A)
-#define /*0x0B4*/ oVelZ                       OBJECT_FIELD_F32(0x0B)
-#define /*0x0B8*/ oForwardVel                 OBJECT_FIELD_F32(0x0C)
-#define /*0x0B8*/ oForwardVelS32              OBJECT_FIELD_S32(0x0C)
-#define /*0x0BC*/ oLeftVel                    OBJECT_FIELD_F32(0x0D)
-#define /*0x0C0*/ oUpVel                      OBJECT_FIELD_F32(0x0E)
-#define /*0x0C4*/ O_MOVE_ANGLE_INDEX          0x0F
-#define /*0x0C4*/ O_MOVE_ANGLE_PITCH_INDEX    (O_MOVE_ANGLE_INDEX + 0)
-#define /*0x0C4*/ O_MOVE_ANGLE_YAW_INDEX      (O_MOVE_ANGLE_INDEX + 1)
-#define /*0x0C4*/ O_MOVE_ANGLE_ROLL_INDEX     (O_MOVE_ANGLE_INDEX + 2)
-#define /*0x0C4*/ oMoveAnglePitch             OBJECT_FIELD_S32(O_MOVE_ANGLE_PITCH_INDEX)
-#define /*0x0C8*/ oMoveAngleYaw               OBJECT_FIELD_S32(O_MOVE_ANGLE_YAW_INDEX)
-#define /*0x0CC*/ oMoveAngleRoll              OBJECT_FIELD_S32(O_MOVE_ANGLE_ROLL_INDEX)
-#define /*0x0D0*/ O_FACE_ANGLE_INDEX          0x12
-#define /*0x0D0*/ O_FACE_ANGLE_PITCH_INDEX    (O_FACE_ANGLE_INDEX + 0)
-#define /*0x0D0*/ O_FACE_ANGLE_YAW_INDEX      (O_FACE_ANGLE_INDEX + 1)
-#define /*0x0D0*/ O_FACE_ANGLE_ROLL_INDEX     (O_FACE_ANGLE_INDEX + 2)
-#define /*0x0D0*/ oFaceAnglePitch             OBJECT_FIELD_S32(O_FACE_ANGLE_PITCH_INDEX)
-#define /*0x0D4*/ oFaceAngleYaw               OBJECT_FIELD_S32(O_FACE_ANGLE_YAW_INDEX)
-#define /*0x0D8*/ oFaceAngleRoll              OBJECT_FIELD_S32(O_FACE_ANGLE_ROLL_INDEX)
-#define /*0x0DC*/ oGraphYOffset               OBJECT_FIELD_F32(0x15)
-#define /*0x0E0*/ oActiveParticleFlags        OBJECT_FIELD_U32(0x16)
-#define /*0x0E4*/ oGravity                    OBJECT_FIELD_F32(0x17)
-#define /*0x0E8*/ oFloorHeight                OBJECT_FIELD_F32(0x18)
-#define /*0x0EC*/ oMoveFlags                  OBJECT_FIELD_U32(0x19)
-#define /*0x0F0*/ oAnimState                  OBJECT_FIELD_S32(0x1A)
-// 0x0F4-0x110 (0x1B-0x22) are object specific and defined below the common fields.
-#define /*0x114*/ oAngleVelPitch              OBJECT_FIELD_S32(0x23)
-#define /*0x118*/ oAngleVelYaw                OBJECT_FIELD_S32(0x24)
-#define /*0x11C*/ oAngleVelRoll               OBJECT_FIELD_S32(0x25)
-#define /*0x120*/ oAnimations                 OBJECT_FIELD_ANIMS(0x26)
-#define /*0x124*/ oHeldState                  OBJECT_FIELD_U32(0x27)
-#define /*0x128*/ oWallHitboxRadius           OBJECT_FIELD_F32(0x28)
-#define /*0x12C*/ oDragStrength               OBJECT_FIELD_F32(0x29)
-#define /*0x130*/ oInteractType               OBJECT_FIELD_U32(0x2A)
-#define /*0x134*/ oInteractStatus             OBJECT_FIELD_S32(0x2B)
-#define /*0x138*/ O_PARENT_RELATIVE_POS_INDEX 0x2C
-#define /*0x138*/ oParentRelativePosX         OBJECT_FIELD_F32(O_PARENT_RELATIVE_POS_INDEX + 0)
-#define /*0x13C*/ oParentRelativePosY         OBJECT_FIELD_F32(O_PARENT_RELATIVE_POS_INDEX + 1)
-#define /*0x140*/ oParentRelativePosZ         OBJECT_FIELD_F32(O_PARENT_RELATIVE_POS_INDEX + 2)
-#define /*0x144*/ oBhvParams2ndByte           OBJECT_FIELD_S32(0x2F)
-// 0x148 unused, possibly a third param byte.
-#define /*0x14C*/ oAction                     OBJECT_FIELD_S32(0x31)
-#define /*0x150*/ oSubAction                  OBJECT_FIELD_S32(0x32)
-#define /*0x154*/ oTimer                      OBJECT_FIELD_S32(0x33)
-#define /*0x158*/ oBounciness                 OBJECT_FIELD_F32(0x34)
-#define /*0x15C*/ oDistanceToMario            OBJECT_FIELD_F32(0x35)
-#define /*0x160*/ oAngleToMario               OBJECT_FIELD_S32(0x36)
-#define /*0x164*/ oHomeX                      OBJECT_FIELD_F32(0x37)
-#define /*0x168*/ oHomeY                      OBJECT_FIELD_F32(0x38)
-#define /*0x16C*/ oHomeZ                      OBJECT_FIELD_F32(0x39)
-#define /*0x170*/ oFriction                   OBJECT_FIELD_F32(0x3A)
-#define /*0x174*/ oBuoyancy                   OBJECT_FIELD_F32(0x3B)
-#define /*0x178*/ oSoundStateID               OBJECT_FIELD_S32(0x3C)
-#define /*0x17C*/ oOpacity                    OBJECT_FIELD_S32(0x3D)
-#define /*0x180*/ oDamageOrCoinValue          OBJECT_FIELD_S32(0x3E)
-#define /*0x184*/ oHealth                     OBJECT_FIELD_S32(0x3F)
-#define /*0x188*/ oBhvParams                  OBJECT_FIELD_S32(0x40)
-#define /*0x18C*/ oPrevAction                 OBJECT_FIELD_S32(0x41)
-#define /*0x190*/ oInteractionSubtype         OBJECT_FIELD_U32(0x42)
-#define /*0x194*/ oCollisionDistance          OBJECT_FIELD_F32(0x43)
-#define /*0x198*/ oNumLootCoins               OBJECT_FIELD_S32(0x44)
-#define /*0x19C*/ oDrawingDistance            OBJECT_FIELD_F32(0x45)
-#define /*0x1A0*/ oRoom                       OBJECT_FIELD_S32(0x46)
-// 0x1A4 is unused, possibly related to 0x1A8 in removed macro purposes.
-#define /*0x1A8*/ oUnusedBhvParams            OBJECT_FIELD_U32(0x48)
-// 0x1AC-0x1B2 (0x48-0x4A) are object specific and defined below the common fields.
-#define /*0x1B4*/ oWallAngle                  OBJECT_FIELD_S32(0x4B)
-#define /*0x1B8*/ oFloorType                  OBJECT_FIELD_S16(0x4C, 0)
-#define /*0x1BA*/ oFloorRoom                  OBJECT_FIELD_S16(0x4C, 1)
-#define /*0x1BC*/ oAngleToHome                OBJECT_FIELD_S32(0x4D)
-#define /*0x1C0*/ oFloor                      OBJECT_FIELD_SURFACE(0x4E)
-#define /*0x1C4*/ oDeathSound                 OBJECT_FIELD_S32(0x4F)
+#define /*0x0B8*/ oFlags                      OBJECT_FIELD_U32(0x01)
+#define /*0x0BC*/ oDialogResponse             OBJECT_FIELD_S16(0x02, 0)
+#define /*0x0BE*/ oDialogState                OBJECT_FIELD_S16(0x02, 1)
+#define /*0x0C0*/ oUnk94                      OBJECT_FIELD_U32(0x03)
+// 0xC4 unused/removed.
+#define /*0x0C8*/ oIntangibleTimer            OBJECT_FIELD_S32(0x05)
+#define /*0x0CC*/ O_POS_INDEX                 0x06
+#define /*0x0CC*/ oPosX                       OBJECT_FIELD_F32(O_POS_INDEX + 0)
+#define /*0x0D0*/ oPosY                       OBJECT_FIELD_F32(O_POS_INDEX + 1)
+#define /*0x0D4*/ oPosZ                       OBJECT_FIELD_F32(O_POS_INDEX + 2)
+#define /*0x0D8*/ oVelX                       OBJECT_FIELD_F32(0x09)
+#define /*0x0DC*/ oVelY                       OBJECT_FIELD_F32(0x0A)
+#define /*0x0E0*/ oVelZ                       OBJECT_FIELD_F32(0x0B)
+#define /*0x0E4*/ oForwardVel                 OBJECT_FIELD_F32(0x0C)
+#define /*0x0E4*/ oForwardVelS32              OBJECT_FIELD_S32(0x0C)
+#define /*0x0E8*/ oLeftVel                    OBJECT_FIELD_F32(0x0D)
+#define /*0x0EC*/ oUpVel                      OBJECT_FIELD_F32(0x0E)
+#define /*0x0F0*/ O_MOVE_ANGLE_INDEX          0x0F
+#define /*0x0F0*/ O_MOVE_ANGLE_PITCH_INDEX    (O_MOVE_ANGLE_INDEX + 0)
+#define /*0x0F0*/ O_MOVE_ANGLE_YAW_INDEX      (O_MOVE_ANGLE_INDEX + 1)
+#define /*0x0F0*/ O_MOVE_ANGLE_ROLL_INDEX     (O_MOVE_ANGLE_INDEX + 2)
+#define /*0x0F0*/ oMoveAnglePitch             OBJECT_FIELD_S32(O_MOVE_ANGLE_PITCH_INDEX)
+#define /*0x0F4*/ oMoveAngleYaw               OBJECT_FIELD_S32(O_MOVE_ANGLE_YAW_INDEX)
+#define /*0x0F8*/ oMoveAngleRoll              OBJECT_FIELD_S32(O_MOVE_ANGLE_ROLL_INDEX)
+#define /*0x0FC*/ O_FACE_ANGLE_INDEX          0x12
+#define /*0x0FC*/ O_FACE_ANGLE_PITCH_INDEX    (O_FACE_ANGLE_INDEX + 0)
+#define /*0x0FC*/ O_FACE_ANGLE_YAW_INDEX      (O_FACE_ANGLE_INDEX + 1)
+#define /*0x0FC*/ O_FACE_ANGLE_ROLL_INDEX     (O_FACE_ANGLE_INDEX + 2)
+#define /*0x0FC*/ oFaceAnglePitch             OBJECT_FIELD_S32(O_FACE_ANGLE_PITCH_INDEX)
+#define /*0x100*/ oFaceAngleYaw               OBJECT_FIELD_S32(O_FACE_ANGLE_YAW_INDEX)
+#define /*0x104*/ oFaceAngleRoll              OBJECT_FIELD_S32(O_FACE_ANGLE_ROLL_INDEX)
+#define /*0x108*/ oGraphYOffset               OBJECT_FIELD_F32(0x15)
+#define /*0x10C*/ oActiveParticleFlags        OBJECT_FIELD_U32(0x16)
+#define /*0x110*/ oGravity                    OBJECT_FIELD_F32(0x17)
+#define /*0x114*/ oFloorHeight                OBJECT_FIELD_F32(0x18)
+#define /*0x118*/ oMoveFlags                  OBJECT_FIELD_U32(0x19)
+#define /*0x11C*/ oAnimState                  OBJECT_FIELD_S32(0x1A)
+// 0x120-0x13C (0x1B-0x22) are object specific and defined below the common fields.
+#define /*0x140*/ oAngleVelPitch              OBJECT_FIELD_S32(0x23)
+#define /*0x144*/ oAngleVelYaw                OBJECT_FIELD_S32(0x24)
+#define /*0x148*/ oAngleVelRoll               OBJECT_FIELD_S32(0x25)
+#define /*0x14C*/ oAnimations                 OBJECT_FIELD_ANIMS(0x26)
+#define /*0x150*/ oHeldState                  OBJECT_FIELD_U32(0x27)
+#define /*0x154*/ oWallHitboxRadius           OBJECT_FIELD_F32(0x28)
+#define /*0x158*/ oDragStrength               OBJECT_FIELD_F32(0x29)
+#define /*0x15C*/ O_INTERACT_TYPE_INDEX       0x2A
+#define /*0x15C*/ oInteractType               OBJECT_FIELD_U32(O_INTERACT_TYPE_INDEX)
+#define /*0x160*/ oInteractStatus             OBJECT_FIELD_S32(0x2B)
+#define /*0x164*/ O_PARENT_RELATIVE_POS_INDEX 0x2C
+#define /*0x164*/ oParentRelativePosX         OBJECT_FIELD_F32(O_PARENT_RELATIVE_POS_INDEX + 0)
+#define /*0x168*/ oParentRelativePosY         OBJECT_FIELD_F32(O_PARENT_RELATIVE_POS_INDEX + 1)
+#define /*0x16C*/ oParentRelativePosZ         OBJECT_FIELD_F32(O_PARENT_RELATIVE_POS_INDEX + 2)
+#define /*0x170*/ oBhvParams2ndByte           OBJECT_FIELD_S32(0x2F)
+// 0x174 unused, possibly a third param byte.
+#define /*0x178*/ oAction                     OBJECT_FIELD_S32(0x31)
+#define /*0x17C*/ oSubAction                  OBJECT_FIELD_S32(0x32)
+#define /*0x180*/ oTimer                      OBJECT_FIELD_S32(0x33)
+#define /*0x184*/ oBounciness                 OBJECT_FIELD_F32(0x34)
+#define /*0x188*/ oDistanceToMario            OBJECT_FIELD_F32(0x35)
+#define /*0x18C*/ oAngleToMario               OBJECT_FIELD_S32(0x36)
+#define /*0x190*/ oHomeX                      OBJECT_FIELD_F32(0x37)
+#define /*0x194*/ oHomeY                      OBJECT_FIELD_F32(0x38)
+#define /*0x198*/ oHomeZ                      OBJECT_FIELD_F32(0x39)
+#define /*0x19C*/ oFriction                   OBJECT_FIELD_F32(0x3A)
+#define /*0x1A0*/ oBuoyancy                   OBJECT_FIELD_F32(0x3B)
+#define /*0x1A4*/ oSoundStateID               OBJECT_FIELD_S32(0x3C)
+#define /*0x1A8*/ oOpacity                    OBJECT_FIELD_S32(0x3D)
+#define /*0x1AC*/ oDamageOrCoinValue          OBJECT_FIELD_S32(0x3E)
+#define /*0x1B0*/ oHealth                     OBJECT_FIELD_S32(0x3F)
+#define /*0x1B4*/ oBhvParams                  OBJECT_FIELD_S32(0x40)
+#define /*0x1B8*/ oPrevAction                 OBJECT_FIELD_S32(0x41)
+#define /*0x1BC*/ oInteractionSubtype         OBJECT_FIELD_U32(0x42)
+#define /*0x1C0*/ oCollisionDistance          OBJECT_FIELD_F32(0x43)
+#define /*0x1C4*/ oNumLootCoins               OBJECT_FIELD_S32(0x44)
+#define /*0x1C8*/ oDrawingDistance            OBJECT_FIELD_F32(0x45)
+#define /*0x1CC*/ oRoom                       OBJECT_FIELD_S32(0x46)
+// 0x1D0 is unused, possibly related to 0x1D4 in removed macro purposes.
+#define /*0x1D4*/ oUnusedBhvParams            OBJECT_FIELD_U32(0x48)
+// 0x1D8-0x1DE (0x48-0x4A) are object specific and defined below the common fields.
+#define /*0x1E0*/ oWallAngle                  OBJECT_FIELD_S32(0x4B)
+#define /*0x1E4*/ oFloorType                  OBJECT_FIELD_S16(0x4C, 0)
+#define /*0x1E6*/ oFloorRoom                  OBJECT_FIELD_S16(0x4C, 1)
+#define /*0x1E8*/ oAngleToHome                OBJECT_FIELD_S32(0x4D)
+#define /*0x1EC*/ oFloor                      OBJECT_FIELD_SURFACE(0x4E)
+#define /*0x1F0*/ oDeathSound                 OBJECT_FIELD_S32(0x4F)
 
 /* Pathed (see obj_follow_path) */
-#define /*0x0FC*/ oPathedStartWaypoint     OBJECT_FIELD_WAYPOINT(0x1D)
-#define /*0x100*/ oPathedPrevWaypoint      OBJECT_FIELD_WAYPOINT(0x1E)
-#define /*0x104*/ oPathedPrevWaypointFlags OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oPathedTargetPitch       OBJECT_FIELD_S32(0x20)
-#define /*0x10C*/ oPathedTargetYaw         OBJECT_FIELD_S32(0x21)
+#define /*0x128*/ oPathedStartWaypoint     OBJECT_FIELD_WAYPOINT(0x1D)
+#define /*0x12C*/ oPathedPrevWaypoint      OBJECT_FIELD_WAYPOINT(0x1E)
+#define /*0x130*/ oPathedPrevWaypointFlags OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oPathedTargetPitch       OBJECT_FIELD_S32(0x20)
+#define /*0x138*/ oPathedTargetYaw         OBJECT_FIELD_S32(0x21)
 
 /* Special Object Macro */
-#define /*0x108*/ oMacroUnk108 OBJECT_FIELD_F32(0x20)
-#define /*0x10C*/ oMacroUnk10C OBJECT_FIELD_F32(0x21)
-#define /*0x110*/ oMacroUnk110 OBJECT_FIELD_F32(0x22)
+#define /*0x134*/ oMacroUnk108 OBJECT_FIELD_F32(0x20)
+#define /*0x138*/ oMacroUnk10C OBJECT_FIELD_F32(0x21)
+#define /*0x13C*/ oMacroUnk110 OBJECT_FIELD_F32(0x22)
 
 /* Mario */
-#define /*0x0F4*/ oMarioParticleFlags    OBJECT_FIELD_S32(0x1B)
-#define /*0x108*/ oMarioPoleUnk108       OBJECT_FIELD_S32(0x20)
-#define /*0x108*/ oMarioReadingSignDYaw  OBJECT_FIELD_S32(0x20)
-#define /*0x10C*/ oMarioPoleYawVel       OBJECT_FIELD_S32(0x21)
-#define /*0x10C*/ oMarioCannonObjectYaw  OBJECT_FIELD_S32(0x21)
-#define /*0x10C*/ oMarioTornadoYawVel    OBJECT_FIELD_S32(0x21)
-#define /*0x10C*/ oMarioReadingSignDPosX OBJECT_FIELD_F32(0x21)
-#define /*0x110*/ oMarioPolePos          OBJECT_FIELD_F32(0x22)
-#define /*0x110*/ oMarioCannonInputYaw   OBJECT_FIELD_S32(0x22)
-#define /*0x110*/ oMarioTornadoPosY      OBJECT_FIELD_F32(0x22)
-#define /*0x110*/ oMarioReadingSignDPosZ OBJECT_FIELD_F32(0x22)
-#define /*0x110*/ oMarioWhirlpoolPosY    OBJECT_FIELD_F32(0x22)
-#define /*0x110*/ oMarioBurnTimer        OBJECT_FIELD_S32(0x22)
-#define /*0x110*/ oMarioLongJumpIsSlow   OBJECT_FIELD_S32(0x22)
-#define /*0x110*/ oMarioSteepJumpYaw     OBJECT_FIELD_S32(0x22)
-#define /*0x110*/ oMarioWalkingPitch     OBJECT_FIELD_S32(0x22)
+#define /*0x120*/ oMarioParticleFlags    OBJECT_FIELD_S32(0x1B)
+#define /*0x134*/ oMarioPoleUnk108       OBJECT_FIELD_S32(0x20)
+#define /*0x134*/ oMarioReadingSignDYaw  OBJECT_FIELD_S32(0x20)
+#define /*0x138*/ oMarioPoleYawVel       OBJECT_FIELD_S32(0x21)
+#define /*0x138*/ oMarioCannonObjectYaw  OBJECT_FIELD_S32(0x21)
+#define /*0x138*/ oMarioTornadoYawVel    OBJECT_FIELD_S32(0x21)
+#define /*0x138*/ oMarioReadingSignDPosX OBJECT_FIELD_F32(0x21)
+#define /*0x13C*/ oMarioPolePos          OBJECT_FIELD_F32(0x22)
+#define /*0x13C*/ oMarioCannonInputYaw   OBJECT_FIELD_S32(0x22)
+#define /*0x13C*/ oMarioTornadoPosY      OBJECT_FIELD_F32(0x22)
+#define /*0x13C*/ oMarioReadingSignDPosZ OBJECT_FIELD_F32(0x22)
+#define /*0x13C*/ oMarioWhirlpoolPosY    OBJECT_FIELD_F32(0x22)
+#define /*0x13C*/ oMarioBurnTimer        OBJECT_FIELD_S32(0x22)
+#define /*0x13C*/ oMarioLongJumpIsSlow   OBJECT_FIELD_S32(0x22)
+#define /*0x13C*/ oMarioSteepJumpYaw     OBJECT_FIELD_S32(0x22)
+#define /*0x13C*/ oMarioWalkingPitch     OBJECT_FIELD_S32(0x22)
 
 /* Hidden 1-Up */
-#define /*0x0F4*/ oHidden1UpNumTouchedTriggers OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oHidden1UpNumTouchedTriggers OBJECT_FIELD_S32(0x1B)
 
 /* Activated Back and Forth Platform */
-#define /*0x0F4*/ oActivatedBackAndForthPlatformMaxOffset    OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oActivatedBackAndForthPlatformOffset       OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oActivatedBackAndForthPlatformVel          OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oActivatedBackAndForthPlatformCountdown    OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oActivatedBackAndForthPlatformStartYaw     OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oActivatedBackAndForthPlatformVertical     OBJECT_FIELD_S32(0x20)
-#define /*0x10C*/ oActivatedBackAndForthPlatformFlipRotation OBJECT_FIELD_S32(0x21)
+#define /*0x120*/ oActivatedBackAndForthPlatformMaxOffset    OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oActivatedBackAndForthPlatformOffset       OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oActivatedBackAndForthPlatformVel          OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oActivatedBackAndForthPlatformCountdown    OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oActivatedBackAndForthPlatformStartYaw     OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oActivatedBackAndForthPlatformVertical     OBJECT_FIELD_S32(0x20)
+#define /*0x138*/ oActivatedBackAndForthPlatformFlipRotation OBJECT_FIELD_S32(0x21)
 
 /* Amp */
-#define /*0x0F4*/ oAmpRadiusOfRotation OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oAmpYPhase           OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oAmpRadiusOfRotation OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oAmpYPhase           OBJECT_FIELD_S32(0x1C)
 
 /* Homing Amp */
-#define /*0x0F4*/ oHomingAmpLockedOn OBJECT_FIELD_S32(0x1B)
-#define /*0x0FC*/ oHomingAmpAvgY     OBJECT_FIELD_F32(0x1D)
+#define /*0x120*/ oHomingAmpLockedOn OBJECT_FIELD_S32(0x1B)
+#define /*0x128*/ oHomingAmpAvgY     OBJECT_FIELD_F32(0x1D)
 
 /* Arrow Lift */
-#define /*0x0F4*/ oArrowLiftDisplacement OBJECT_FIELD_F32(0x1B)
-#define /*0x100*/ oArrowLiftUnk100       OBJECT_FIELD_S32(0x1E)
+#define /*0x120*/ oArrowLiftDisplacement OBJECT_FIELD_F32(0x1B)
+#define /*0x12C*/ oArrowLiftUnk100       OBJECT_FIELD_S32(0x1E)
 
 /* Back-and-Forth Platform */
-#define /*0x0F4*/ oBackAndForthPlatformDirection  OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oBackAndForthPlatformPathLength OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oBackAndForthPlatformDistance   OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oBackAndForthPlatformVel        OBJECT_FIELD_F32(0x1E)
+#define /*0x120*/ oBackAndForthPlatformDirection  OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oBackAndForthPlatformPathLength OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oBackAndForthPlatformDistance   OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oBackAndForthPlatformVel        OBJECT_FIELD_F32(0x1E)
 
 /* Bird */
-#define /*0x0F4*/ oBirdSpeed       OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oBirdTargetPitch OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oBirdTargetYaw   OBJECT_FIELD_S32(0x1D)
+#define /*0x120*/ oBirdSpeed       OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oBirdTargetPitch OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oBirdTargetYaw   OBJECT_FIELD_S32(0x1D)
 
 /* Bird Chirp Chirp */
-#define /*0x0F4*/ oBirdChirpChirpUnkF4 OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oBirdChirpChirpUnkF4 OBJECT_FIELD_S32(0x1B)
 
 /* End Birds */
-#define /*0x104*/ oEndBirdUnk104 OBJECT_FIELD_F32(0x1F)
+#define /*0x130*/ oEndBirdUnk104 OBJECT_FIELD_F32(0x1F)
 
 /* Hidden Blue Coin */
-#define /*0x0F8*/ oHiddenBlueCoinSwitch OBJECT_FIELD_OBJ(0x1C)
+#define /*0x124*/ oHiddenBlueCoinSwitch OBJECT_FIELD_OBJ(0x1C)
 
 /* Bob-omb */
-#define /*0x0F4*/ oBobombBlinkTimer OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oBobombFuseLit    OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oBobombFuseTimer  OBJECT_FIELD_S32(0x1D)
+#define /*0x120*/ oBobombBlinkTimer OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oBobombFuseLit    OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oBobombFuseTimer  OBJECT_FIELD_S32(0x1D)
 
 /* Bob-omb Buddy */
-#define /*0x0F4*/ oBobombBuddyBlinkTimer       OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oBobombBuddyHasTalkedToMario OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oBobombBuddyRole             OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oBobombBuddyCannonStatus     OBJECT_FIELD_S32(0x1E)
-#define /*0x108*/ oBobombBuddyPosXCopy         OBJECT_FIELD_F32(0x20)
-#define /*0x10C*/ oBobombBuddyPosYCopy         OBJECT_FIELD_F32(0x21)
-#define /*0x110*/ oBobombBuddyPosZCopy         OBJECT_FIELD_F32(0x22)
+#define /*0x120*/ oBobombBuddyBlinkTimer       OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oBobombBuddyHasTalkedToMario OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oBobombBuddyRole             OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oBobombBuddyCannonStatus     OBJECT_FIELD_S32(0x1E)
+#define /*0x134*/ oBobombBuddyPosXCopy         OBJECT_FIELD_F32(0x20)
+#define /*0x138*/ oBobombBuddyPosYCopy         OBJECT_FIELD_F32(0x21)
+#define /*0x13C*/ oBobombBuddyPosZCopy         OBJECT_FIELD_F32(0x22)
 
 /* Bob-omb Explosion Bubble */
-#define /*0x0FC*/ oBobombExpBubGfxScaleFacX OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oBobombExpBubGfxScaleFacY OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oBobombExpBubGfxExpRateX  OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oBobombExpBubGfxExpRateY  OBJECT_FIELD_S32(0x20)
+#define /*0x128*/ oBobombExpBubGfxScaleFacX OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oBobombExpBubGfxScaleFacY OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oBobombExpBubGfxExpRateX  OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oBobombExpBubGfxExpRateY  OBJECT_FIELD_S32(0x20)
 
 /* Bomp (Small) */
-#define /*0x100*/ oSmallBompInitX OBJECT_FIELD_F32(0x1E)
+#define /*0x12C*/ oSmallBompInitX OBJECT_FIELD_F32(0x1E)
 
 /* Boo */
-#define /*0x088*/ oBooDeathStatus           OBJECT_FIELD_S32(0x00)
-#define /*0x0F4*/ oBooTargetOpacity         OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oBooBaseScale             OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oBooOscillationTimer      OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oBooMoveYawDuringHit      OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oBooMoveYawBeforeHit      OBJECT_FIELD_F32(0x1F)
-#define /*0x108*/ oBooParentBigBoo          OBJECT_FIELD_OBJ(0x20)
-#define /*0x10C*/ oBooNegatedAggressiveness OBJECT_FIELD_F32(0x21)
-#define /*0x110*/ oBooInitialMoveYaw        OBJECT_FIELD_S32(0x22)
-#define /*0x1B0*/ oBooTurningSpeed          OBJECT_FIELD_S16(0x4A, 0)
+#define /*0x0B4*/ oBooDeathStatus           OBJECT_FIELD_S32(0x00)
+#define /*0x120*/ oBooTargetOpacity         OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oBooBaseScale             OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oBooOscillationTimer      OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oBooMoveYawDuringHit      OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oBooMoveYawBeforeHit      OBJECT_FIELD_F32(0x1F)
+#define /*0x134*/ oBooParentBigBoo          OBJECT_FIELD_OBJ(0x20)
+#define /*0x138*/ oBooNegatedAggressiveness OBJECT_FIELD_F32(0x21)
+#define /*0x13C*/ oBooInitialMoveYaw        OBJECT_FIELD_S32(0x22)
+#define /*0x1DC*/ oBooTurningSpeed          OBJECT_FIELD_S16(0x4A, 0)
 
 /* Big Boo */
-#define /*0x1AC*/ oBigBooNumMinionBoosKilled OBJECT_FIELD_S32(0x49)
+#define /*0x1D8*/ oBigBooNumMinionBoosKilled OBJECT_FIELD_S32(0x49)
 
 /* Bookend */
-#define /*0x0F4*/ oBookendUnkF4 OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oBookendUnkF8 OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oBookendUnkF4 OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oBookendUnkF8 OBJECT_FIELD_S32(0x1C)
 
 /* Book Switch */
-#define /*0x0F4*/ oBookSwitchUnkF4 OBJECT_FIELD_F32(0x1B)
+#define /*0x120*/ oBookSwitchUnkF4 OBJECT_FIELD_F32(0x1B)
 
 /* Book Switch Manager */
-#define /*0x0F4*/ oBookSwitchManagerUnkF4 OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oBookSwitchManagerUnkF8 OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oBookSwitchManagerUnkF4 OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oBookSwitchManagerUnkF8 OBJECT_FIELD_S32(0x1C)
 
 /* Haunted Bookshelf */
-#define /*0x088*/ oHauntedBookshelfShouldOpen OBJECT_FIELD_S32(0x00)
+#define /*0x0B4*/ oHauntedBookshelfShouldOpen OBJECT_FIELD_S32(0x00)
 
 /* Bouncing FireBall */
-#define /*0x0F4*/ oBouncingFireBallUnkF4 OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oBouncingFireBallUnkF4 OBJECT_FIELD_S32(0x1B)
 
 /* Bowling Ball */
-#define /*0x0F4*/ oBowlingBallTargetYaw OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oBowlingBallTargetYaw OBJECT_FIELD_S32(0x1B)
 // 0x1D-0x21 reserved for pathing
 
 /* Bowling Ball Spawner (Generic) */
-#define /*0x0F4*/ oBBallSpawnerMaxSpawnDist OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oBBallSpawnerSpawnOdds    OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oBBallSpawnerPeriodMinus1 OBJECT_FIELD_S32(0x1D)
+#define /*0x120*/ oBBallSpawnerMaxSpawnDist OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oBBallSpawnerSpawnOdds    OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oBBallSpawnerPeriodMinus1 OBJECT_FIELD_S32(0x1D)
 
 /* Bowser */
-#define /*0x088*/ oBowserCamAct          OBJECT_FIELD_S32(0x00)
-#define /*0x0F4*/ oBowserStatus          OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oBowserTimer           OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oBowserDistToCenter    OBJECT_FIELD_F32(0x1D)
-#define /*0x106*/ oBowserBitSJustJump    OBJECT_FIELD_S16(0x1F, 1)
-#define /*0x108*/ oBowserRandSplitFloor  OBJECT_FIELD_S16(0x20, 0)
-#define /*0x10A*/ oBowserHeldAnglePitch  OBJECT_FIELD_S16(0x20, 1)
-#define /*0x10D*/ oBowserHeldAngleVelYaw OBJECT_FIELD_S16(0x21, 0)
-#define /*0x10E*/ oBowserGrabbedStatus   OBJECT_FIELD_S16(0x21, 1)
-#define /*0x110*/ oBowserIsReacting      OBJECT_FIELD_S16(0x22, 0)
-#define /*0x112*/ oBowserAngleToCenter   OBJECT_FIELD_S16(0x22, 1)
-#define /*0x1AC*/ oBowserTargetOpacity   OBJECT_FIELD_S16(0x49, 0)
-#define /*0x1AE*/ oBowserEyesTimer       OBJECT_FIELD_S16(0x49, 1)
-#define /*0x1B0*/ oBowserEyesShut        OBJECT_FIELD_S16(0x4A, 0)
-#define /*0x1B2*/ oBowserRainbowLight    OBJECT_FIELD_S16(0x4A, 1)
+#define /*0x0B4*/ oBowserCamAct          OBJECT_FIELD_S32(0x00)
+#define /*0x120*/ oBowserStatus          OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oBowserTimer           OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oBowserDistToCenter    OBJECT_FIELD_F32(0x1D)
+#define /*0x132*/ oBowserBitSJustJump    OBJECT_FIELD_S16(0x1F, 1)
+#define /*0x134*/ oBowserRandSplitFloor  OBJECT_FIELD_S16(0x20, 0)
+#define /*0x136*/ oBowserHeldAnglePitch  OBJECT_FIELD_S16(0x20, 1)
+#define /*0x139*/ oBowserHeldAngleVelYaw OBJECT_FIELD_S16(0x21, 0)
+#define /*0x13A*/ oBowserGrabbedStatus   OBJECT_FIELD_S16(0x21, 1)
+#define /*0x13C*/ oBowserIsReacting      OBJECT_FIELD_S16(0x22, 0)
+#define /*0x13E*/ oBowserAngleToCenter   OBJECT_FIELD_S16(0x22, 1)
+#define /*0x1D8*/ oBowserTargetOpacity   OBJECT_FIELD_S16(0x49, 0)
+#define /*0x1DA*/ oBowserEyesTimer       OBJECT_FIELD_S16(0x49, 1)
+#define /*0x1DC*/ oBowserEyesShut        OBJECT_FIELD_S16(0x4A, 0)
+#define /*0x1DE*/ oBowserRainbowLight    OBJECT_FIELD_S16(0x4A, 1)
 
 /* Bowser Shockwave */
-#define /*0x0F4*/ oBowserShockWaveScale OBJECT_FIELD_F32(0x1B)
+#define /*0x120*/ oBowserShockWaveScale OBJECT_FIELD_F32(0x1B)
 
 /* Black Smoke Bowser */
-#define /*0x0F4*/ oBlackSmokeBowserUnkF4 OBJECT_FIELD_F32(0x1B)
+#define /*0x120*/ oBlackSmokeBowserUnkF4 OBJECT_FIELD_F32(0x1B)
 
 /* Bowser Key Cutscene */
-#define /*0x0F4*/ oBowserKeyScale OBJECT_FIELD_F32(0x1B)
+#define /*0x120*/ oBowserKeyScale OBJECT_FIELD_F32(0x1B)
 
 /* Bowser Puzzle */
-#define /*0x0F4*/ oBowserPuzzleCompletionFlags OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oBowserPuzzleCompletionFlags OBJECT_FIELD_S32(0x1B)
 
 /* Bowser Puzzle Piece */
-#define /*0x0FC*/ oBowserPuzzlePieceOffsetX                  OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oBowserPuzzlePieceOffsetY                  OBJECT_FIELD_F32(0x1E)
-#define /*0x104*/ oBowserPuzzlePieceOffsetZ                  OBJECT_FIELD_F32(0x1F)
-#define /*0x108*/ oBowserPuzzlePieceContinuePerformingAction OBJECT_FIELD_S32(0x20)
-#define /*0x10C*/ oBowserPuzzlePieceActionList               OBJECT_FIELD_VPTR(0x21)
-#define /*0x110*/ oBowserPuzzlePieceNextAction               OBJECT_FIELD_VPTR(0x22)
+#define /*0x128*/ oBowserPuzzlePieceOffsetX                  OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oBowserPuzzlePieceOffsetY                  OBJECT_FIELD_F32(0x1E)
+#define /*0x130*/ oBowserPuzzlePieceOffsetZ                  OBJECT_FIELD_F32(0x1F)
+#define /*0x134*/ oBowserPuzzlePieceContinuePerformingAction OBJECT_FIELD_S32(0x20)
+#define /*0x138*/ oBowserPuzzlePieceActionList               OBJECT_FIELD_VPTR(0x21)
+#define /*0x13C*/ oBowserPuzzlePieceNextAction               OBJECT_FIELD_VPTR(0x22)
 
 /* Bubba */
-#define /*0x0F4*/ oBubbaUnkF4  OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oBubbaUnkF8  OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oBubbaUnkFC  OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oBubbaUnk100 OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oBubbaUnk104 OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oBubbaUnk108 OBJECT_FIELD_F32(0x20)
-#define /*0x10C*/ oBubbaUnk10C OBJECT_FIELD_F32(0x21)
-#define /*0x1AC*/ oBubbaUnk1AC OBJECT_FIELD_S16(0x49, 0)
-#define /*0x1AE*/ oBubbaUnk1AE OBJECT_FIELD_S16(0x49, 1)
-#define /*0x1B0*/ oBubbaUnk1B0 OBJECT_FIELD_S16(0x4A, 0)
-#define /*0x1B2*/ oBubbaUnk1B2 OBJECT_FIELD_S16(0x4A, 1)
+#define /*0x120*/ oBubbaUnkF4  OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oBubbaUnkF8  OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oBubbaUnkFC  OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oBubbaUnk100 OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oBubbaUnk104 OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oBubbaUnk108 OBJECT_FIELD_F32(0x20)
+#define /*0x138*/ oBubbaUnk10C OBJECT_FIELD_F32(0x21)
+#define /*0x1D8*/ oBubbaUnk1AC OBJECT_FIELD_S16(0x49, 0)
+#define /*0x1DA*/ oBubbaUnk1AE OBJECT_FIELD_S16(0x49, 1)
+#define /*0x1DC*/ oBubbaUnk1B0 OBJECT_FIELD_S16(0x4A, 0)
+#define /*0x1DE*/ oBubbaUnk1B2 OBJECT_FIELD_S16(0x4A, 1)
 
 /* Bullet Bill */
-#define /*0x0F8*/ oBulletBillInitialMoveYaw OBJECT_FIELD_S32(0x1C)
+#define /*0x124*/ oBulletBillInitialMoveYaw OBJECT_FIELD_S32(0x1C)
 
 /* Bully (all variants) */
-#define /*0x0F4*/ oBullySubtype                   OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oBullyPrevX                     OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oBullyPrevY                     OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oBullyPrevZ                     OBJECT_FIELD_F32(0x1E)
-#define /*0x104*/ oBullyKBTimerAndMinionKOCounter OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oBullyMarioCollisionAngle       OBJECT_FIELD_S32(0x20)
+#define /*0x120*/ oBullySubtype                   OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oBullyPrevX                     OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oBullyPrevY                     OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oBullyPrevZ                     OBJECT_FIELD_F32(0x1E)
+#define /*0x130*/ oBullyKBTimerAndMinionKOCounter OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oBullyMarioCollisionAngle       OBJECT_FIELD_S32(0x20)
 
 /* Butterfly */
-#define /*0x0F4*/ oButterflyYPhase OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oButterflyYPhase OBJECT_FIELD_S32(0x1B)
 
 /* Triplet Butterfly */
-#define /*0x0F4*/ oTripletButterflyScale             OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oTripletButterflySpeed             OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oTripletButterflyBaseYaw           OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oTripletButterflyTargetPitch       OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oTripletButterflyTargetYaw         OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oTripletButterflyType              OBJECT_FIELD_S32(0x20)
-#define /*0x10C*/ oTripletButterflyModel             OBJECT_FIELD_S32(0x21)
-#define /*0x110*/ oTripletButterflySelectedButterfly OBJECT_FIELD_S32(0x22)
-#define /*0x1AC*/ oTripletButterflyScalePhase        OBJECT_FIELD_S32(0x49)
+#define /*0x120*/ oTripletButterflyScale             OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oTripletButterflySpeed             OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oTripletButterflyBaseYaw           OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oTripletButterflyTargetPitch       OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oTripletButterflyTargetYaw         OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oTripletButterflyType              OBJECT_FIELD_S32(0x20)
+#define /*0x138*/ oTripletButterflyModel             OBJECT_FIELD_S32(0x21)
+#define /*0x13C*/ oTripletButterflySelectedButterfly OBJECT_FIELD_S32(0x22)
+#define /*0x1D8*/ oTripletButterflyScalePhase        OBJECT_FIELD_S32(0x49)
 
 /* Cannon */
-#define /*0x0F4*/ oCannonUnkF4  OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oCannonUnkF8  OBJECT_FIELD_S32(0x1C)
-#define /*0x10C*/ oCannonUnk10C OBJECT_FIELD_S32(0x21)
+#define /*0x120*/ oCannonUnkF4  OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oCannonUnkF8  OBJECT_FIELD_S32(0x1C)
+#define /*0x138*/ oCannonUnk10C OBJECT_FIELD_S32(0x21)
 
 /* Cap */
-#define /*0x0F4*/ oCapUnkF4 OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oCapUnkF8 OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oCapUnkF4 OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oCapUnkF8 OBJECT_FIELD_S32(0x1C)
 
 /* Checkerboard Platform */
-#define /*0x0F8*/ oCheckerBoardPlatformUnkF8  OBJECT_FIELD_S32(0x1C) // oAction like
-#define /*0x0FC*/ oCheckerBoardPlatformUnkFC  OBJECT_FIELD_S32(0x1D)
-#define /*0x1AC*/ oCheckerBoardPlatformUnk1AC OBJECT_FIELD_F32(0x49)
+#define /*0x124*/ oCheckerBoardPlatformUnkF8  OBJECT_FIELD_S32(0x1C) // oAction like
+#define /*0x128*/ oCheckerBoardPlatformUnkFC  OBJECT_FIELD_S32(0x1D)
+#define /*0x1D8*/ oCheckerBoardPlatformUnk1AC OBJECT_FIELD_F32(0x49)
 
 /* Cheep Cheep */
-#define /*0x0F4*/ oCheepCheepUnkF4  OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oCheepCheepUnkF8  OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oCheepCheepUnkFC  OBJECT_FIELD_F32(0x1D)
-#define /*0x104*/ oCheepCheepUnk104 OBJECT_FIELD_F32(0x1F)
-#define /*0x108*/ oCheepCheepUnk108 OBJECT_FIELD_F32(0x20)
+#define /*0x120*/ oCheepCheepUnkF4  OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oCheepCheepUnkF8  OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oCheepCheepUnkFC  OBJECT_FIELD_F32(0x1D)
+#define /*0x130*/ oCheepCheepUnk104 OBJECT_FIELD_F32(0x1F)
+#define /*0x134*/ oCheepCheepUnk108 OBJECT_FIELD_F32(0x20)
 
 /* Chuckya */
-#define /*0x088*/ oChuckyaUnk88  OBJECT_FIELD_S32(0x00)
-#define /*0x0F8*/ oChuckyaUnkF8  OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oChuckyaUnkFC  OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oChuckyaUnk100 OBJECT_FIELD_S32(0x1E)
+#define /*0x0B4*/ oChuckyaUnk88  OBJECT_FIELD_S32(0x00)
+#define /*0x124*/ oChuckyaUnkF8  OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oChuckyaUnkFC  OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oChuckyaUnk100 OBJECT_FIELD_S32(0x1E)
 
 /* Clam */
-#define /*0x0F4*/ oClamUnkF4 OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oClamUnkF4 OBJECT_FIELD_S32(0x1B)
 
 /* Cloud */
-#define /*0x0F4*/ oCloudCenterX              OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oCloudCenterY              OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oCloudBlowing              OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oCloudGrowSpeed            OBJECT_FIELD_F32(0x1E)
-#define /*0x1AC*/ oCloudFwooshMovementRadius OBJECT_FIELD_S16(0x49, 0)
+#define /*0x120*/ oCloudCenterX              OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oCloudCenterY              OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oCloudBlowing              OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oCloudGrowSpeed            OBJECT_FIELD_F32(0x1E)
+#define /*0x1D8*/ oCloudFwooshMovementRadius OBJECT_FIELD_S16(0x49, 0)
 
 /* Coin */
-#define /*0x0F4*/ oCoinCollectedFlags       OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oCoinOnGround             OBJECT_FIELD_S32(0x1C)
-#define /*0x110*/ oCoinBaseVelY             OBJECT_FIELD_F32(0x22)
+#define /*0x120*/ oCoinCollectedFlags       OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oCoinOnGround             OBJECT_FIELD_S32(0x1C)
+#define /*0x13C*/ oCoinBaseVelY             OBJECT_FIELD_F32(0x22)
 
 /* Collision Particle */
-#define /*0x0F4*/ oCollisionParticleUnkF4 OBJECT_FIELD_F32(0x1B)
+#define /*0x120*/ oCollisionParticleUnkF4 OBJECT_FIELD_F32(0x1B)
 
 /* Controllable Platform */
-#define /*0x0F8*/ oControllablePlatformUnkF8  OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oControllablePlatformUnkFC  OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oControllablePlatformUnk100 OBJECT_FIELD_S32(0x1E)
+#define /*0x124*/ oControllablePlatformUnkF8  OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oControllablePlatformUnkFC  OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oControllablePlatformUnk100 OBJECT_FIELD_S32(0x1E)
 
 /* Breakable Box Small (Small Cork Box) */
-#define /*0x0F4*/ oBreakableBoxSmallReleased            OBJECT_FIELD_S32(0x1B)
-#define /*0x0FC*/ oBreakableBoxSmallFramesSinceReleased OBJECT_FIELD_S32(0x1D)
+#define /*0x120*/ oBreakableBoxSmallReleased            OBJECT_FIELD_S32(0x1B)
+#define /*0x128*/ oBreakableBoxSmallFramesSinceReleased OBJECT_FIELD_S32(0x1D)
 
 /* Jumping Box (Crazy Box) */
-#define /*0x0F4*/ oJumpingBoxUnkF4 OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oJumpingBoxUnkF8 OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oJumpingBoxUnkF4 OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oJumpingBoxUnkF8 OBJECT_FIELD_S32(0x1C)
 
 /* RR Cruiser Wing */
-#define /*0x0F4*/ oRRCruiserWingUnkF4 OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oRRCruiserWingUnkF8 OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oRRCruiserWingUnkF4 OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oRRCruiserWingUnkF8 OBJECT_FIELD_S32(0x1C)
 
 /* Donut Platform Spawner */
-#define /*0x0F4*/ oDonutPlatformSpawnerSpawnedPlatforms OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oDonutPlatformSpawnerSpawnedPlatforms OBJECT_FIELD_S32(0x1B)
 
 /* Door */
-#define /*0x088*/ oDoorUnk88  OBJECT_FIELD_S32(0x00)
-#define /*0x0F8*/ oDoorUnkF8  OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oDoorUnkFC  OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oDoorUnk100 OBJECT_FIELD_S32(0x1E)
+#define /*0x0B4*/ oDoorUnk88  OBJECT_FIELD_S32(0x00)
+#define /*0x124*/ oDoorUnkF8  OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oDoorUnkFC  OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oDoorUnk100 OBJECT_FIELD_S32(0x1E)
 
 /* Dorrie */
-#define /*0x0F4*/ oDorrieDistToHome         OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oDorrieOffsetY            OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oDorrieVelY               OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oDorrieForwardDistToMario OBJECT_FIELD_F32(0x1E)
-#define /*0x104*/ oDorrieYawVel             OBJECT_FIELD_S32(0x1F)
-#define /*0x10C*/ oDorrieLiftingMario       OBJECT_FIELD_S32(0x21)
-#define /*0x1AC*/ oDorrieGroundPounded      OBJECT_FIELD_S16(0x49, 0)
-#define /*0x1AE*/ oDorrieAngleToHome        OBJECT_FIELD_S16(0x49, 1)
-#define /*0x1B0*/ oDorrieNeckAngle          OBJECT_FIELD_S16(0x4A, 0)
-#define /*0x1B2*/ oDorrieHeadRaiseSpeed     OBJECT_FIELD_S16(0x4A, 1)
+#define /*0x120*/ oDorrieDistToHome         OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oDorrieOffsetY            OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oDorrieVelY               OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oDorrieForwardDistToMario OBJECT_FIELD_F32(0x1E)
+#define /*0x130*/ oDorrieYawVel             OBJECT_FIELD_S32(0x1F)
+#define /*0x138*/ oDorrieLiftingMario       OBJECT_FIELD_S32(0x21)
+#define /*0x1D8*/ oDorrieGroundPounded      OBJECT_FIELD_S16(0x49, 0)
+#define /*0x1DA*/ oDorrieAngleToHome        OBJECT_FIELD_S16(0x49, 1)
+#define /*0x1DC*/ oDorrieNeckAngle          OBJECT_FIELD_S16(0x4A, 0)
+#define /*0x1DE*/ oDorrieHeadRaiseSpeed     OBJECT_FIELD_S16(0x4A, 1)
 
 /* Elevator */
-#define /*0x0F4*/ oElevatorUnkF4  OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oElevatorUnkF8  OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oElevatorUnkFC  OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oElevatorUnk100 OBJECT_FIELD_S32(0x1E)
+#define /*0x120*/ oElevatorUnkF4  OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oElevatorUnkF8  OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oElevatorUnkFC  OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oElevatorUnk100 OBJECT_FIELD_S32(0x1E)
 
 /* Exclamation Box */
-#define /*0x0F4*/ oExclamationBoxUnkF4 OBJECT_FIELD_F32(0x1B) // scale?
-#define /*0x0F8*/ oExclamationBoxUnkF8 OBJECT_FIELD_F32(0x1C) // scale?
-#define /*0x0FC*/ oExclamationBoxUnkFC OBJECT_FIELD_S32(0x1D) // angle?
+#define /*0x120*/ oExclamationBoxUnkF4 OBJECT_FIELD_F32(0x1B) // scale?
+#define /*0x124*/ oExclamationBoxUnkF8 OBJECT_FIELD_F32(0x1C) // scale?
+#define /*0x128*/ oExclamationBoxUnkFC OBJECT_FIELD_S32(0x1D) // angle?
 
 /* Eyerok Boss */
-#define /*0x0F8*/ oEyerokBossNumHands   OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oEyerokBossUnkFC      OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oEyerokBossActiveHand OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oEyerokBossUnk104     OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oEyerokBossUnk108     OBJECT_FIELD_F32(0x20)
-#define /*0x10C*/ oEyerokBossUnk10C     OBJECT_FIELD_F32(0x21)
-#define /*0x110*/ oEyerokBossUnk110     OBJECT_FIELD_F32(0x22)
-#define /*0x1AC*/ oEyerokBossUnk1AC     OBJECT_FIELD_S32(0x49)
+#define /*0x124*/ oEyerokBossNumHands   OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oEyerokBossUnkFC      OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oEyerokBossActiveHand OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oEyerokBossUnk104     OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oEyerokBossUnk108     OBJECT_FIELD_F32(0x20)
+#define /*0x138*/ oEyerokBossUnk10C     OBJECT_FIELD_F32(0x21)
+#define /*0x13C*/ oEyerokBossUnk110     OBJECT_FIELD_F32(0x22)
+#define /*0x1D8*/ oEyerokBossUnk1AC     OBJECT_FIELD_S32(0x49)
 
 /* Eyerok Hand */
-#define /*0x0F4*/ oEyerokHandWakeUpTimer OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oEyerokReceivedAttack  OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oEyerokHandUnkFC       OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oEyerokHandUnk100      OBJECT_FIELD_S32(0x1E)
+#define /*0x120*/ oEyerokHandWakeUpTimer OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oEyerokReceivedAttack  OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oEyerokHandUnkFC       OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oEyerokHandUnk100      OBJECT_FIELD_S32(0x1E)
 
 /* Falling Pillar */
-#define /*0x0F4*/ oFallingPillarPitchAcceleration OBJECT_FIELD_F32(0x1B)
+#define /*0x120*/ oFallingPillarPitchAcceleration OBJECT_FIELD_F32(0x1B)
 
 /* Fire Spitter */
-#define /*0x0F4*/ oFireSpitterScaleVel OBJECT_FIELD_F32(0x1B)
+#define /*0x120*/ oFireSpitterScaleVel OBJECT_FIELD_F32(0x1B)
 
 /* Blue Fish */
-#define /*0x0F4*/ oBlueFishRandomVel   OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oBlueFishRandomTime  OBJECT_FIELD_S32(0x1C)
-#define /*0x100*/ oBlueFishRandomAngle OBJECT_FIELD_F32(0x1E)
+#define /*0x120*/ oBlueFishRandomVel   OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oBlueFishRandomTime  OBJECT_FIELD_S32(0x1C)
+#define /*0x12C*/ oBlueFishRandomAngle OBJECT_FIELD_F32(0x1E)
 
 /* Fish Group */
-#define /*0x0F4*/ oFishWaterLevel     OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oFishGoalY          OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oFishHeightOffset   OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oFishYawVel         OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oFishRoamDistance   OBJECT_FIELD_F32(0x1F)
-#define /*0x108*/ oFishGoalVel        OBJECT_FIELD_F32(0x20)
-#define /*0x10C*/ oFishDepthDistance  OBJECT_FIELD_F32(0x21)
-#define /*0x110*/ oFishActiveDistance OBJECT_FIELD_F32(0x22)
+#define /*0x120*/ oFishWaterLevel     OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oFishGoalY          OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oFishHeightOffset   OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oFishYawVel         OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oFishRoamDistance   OBJECT_FIELD_F32(0x1F)
+#define /*0x134*/ oFishGoalVel        OBJECT_FIELD_F32(0x20)
+#define /*0x138*/ oFishDepthDistance  OBJECT_FIELD_F32(0x21)
+#define /*0x13C*/ oFishActiveDistance OBJECT_FIELD_F32(0x22)
 
 /* Flame */
-#define /*0x0F4*/ oFlameScale            OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oFlameSpeedTimerOffset OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oFlameUnusedRand       OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oFlameBowser           OBJECT_FIELD_OBJ(0x1E)
+#define /*0x120*/ oFlameScale            OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oFlameSpeedTimerOffset OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oFlameUnusedRand       OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oFlameBowser           OBJECT_FIELD_OBJ(0x1E)
 
 /* Blue Flame */
-#define /*0x0F8*/ oBlueFlameNextScale OBJECT_FIELD_F32(0x1C)
+#define /*0x124*/ oBlueFlameNextScale OBJECT_FIELD_F32(0x1C)
 
 /* Small Piranha Flame */
-#define /*0x0F4*/ oSmallPiranhaFlameStartSpeed     OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oSmallPiranhaFlameEndSpeed       OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oSmallPiranhaFlameModel          OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oSmallPiranhaFlameNextFlameTimer OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oSmallPiranhaFlameSpeed          OBJECT_FIELD_F32(0x1F)
+#define /*0x120*/ oSmallPiranhaFlameStartSpeed     OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oSmallPiranhaFlameEndSpeed       OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oSmallPiranhaFlameModel          OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oSmallPiranhaFlameNextFlameTimer OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oSmallPiranhaFlameSpeed          OBJECT_FIELD_F32(0x1F)
 
 /* Moving Flame */
-#define /*0x0F4*/ oMovingFlameTimer OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oMovingFlameTimer OBJECT_FIELD_S32(0x1B)
 
 /* Flamethrower Flame */
-#define /*0x110*/ oFlameThowerFlameUnk110 OBJECT_FIELD_S32(0x22)
+#define /*0x13C*/ oFlameThowerFlameUnk110 OBJECT_FIELD_S32(0x22)
 
 /* Flamethrower */
-#define /*0x110*/ oFlameThowerUnk110 OBJECT_FIELD_S32(0x22)
+#define /*0x13C*/ oFlameThowerUnk110 OBJECT_FIELD_S32(0x22)
 
 /* Floating Platform */
-#define /*0x0F4*/ oFloatingPlatformUnkF4  OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oFloatingPlatformUnkF8  OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oFloatingPlatformUnkFC  OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oFloatingPlatformUnk100 OBJECT_FIELD_S32(0x1E)
+#define /*0x120*/ oFloatingPlatformUnkF4  OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oFloatingPlatformUnkF8  OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oFloatingPlatformUnkFC  OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oFloatingPlatformUnk100 OBJECT_FIELD_S32(0x1E)
 
 /* Floor Switch Press Animation */
-#define /*0x0F4*/ oFloorSwitchPressAnimationUnkF4  OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oFloorSwitchPressAnimationUnkF8  OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oFloorSwitchPressAnimationUnkFC  OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oFloorSwitchPressAnimationUnk100 OBJECT_FIELD_S32(0x1E)
+#define /*0x120*/ oFloorSwitchPressAnimationUnkF4  OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oFloorSwitchPressAnimationUnkF8  OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oFloorSwitchPressAnimationUnkFC  OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oFloorSwitchPressAnimationUnk100 OBJECT_FIELD_S32(0x1E)
 
 /* Fly Guy */
-#define /*0x0F4*/ oFlyGuyIdleTimer        OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oFlyGuyOscTimer         OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oFlyGuyUnusedJitter     OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oFlyGuyLungeYDecel      OBJECT_FIELD_F32(0x1E)
-#define /*0x104*/ oFlyGuyLungeTargetPitch OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oFlyGuyTargetRoll       OBJECT_FIELD_S32(0x20)
-#define /*0x10C*/ oFlyGuyScaleVel         OBJECT_FIELD_F32(0x21)
+#define /*0x120*/ oFlyGuyIdleTimer        OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oFlyGuyOscTimer         OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oFlyGuyUnusedJitter     OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oFlyGuyLungeYDecel      OBJECT_FIELD_F32(0x1E)
+#define /*0x130*/ oFlyGuyLungeTargetPitch OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oFlyGuyTargetRoll       OBJECT_FIELD_S32(0x20)
+#define /*0x138*/ oFlyGuyScaleVel         OBJECT_FIELD_F32(0x21)
 
 /* Grand Star */
-#define /*0x108*/ oGrandStarUnk108 OBJECT_FIELD_S32(0x20)
+#define /*0x134*/ oGrandStarUnk108 OBJECT_FIELD_S32(0x20)
 
 /* Horizontal Grindel */
-#define /*0x0F4*/ oHorizontalGrindelTargetYaw  OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oHorizontalGrindelDistToHome OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oHorizontalGrindelOnGround   OBJECT_FIELD_S32(0x1D)
+#define /*0x120*/ oHorizontalGrindelTargetYaw  OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oHorizontalGrindelDistToHome OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oHorizontalGrindelOnGround   OBJECT_FIELD_S32(0x1D)
 
 /* Goomba */
-#define /*0x0F4*/ oGoombaSize                OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oGoombaScale               OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oGoombaWalkTimer           OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oGoombaTargetYaw           OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oGoombaBlinkTimer          OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oGoombaTurningAwayFromWall OBJECT_FIELD_S32(0x20)
-#define /*0x10C*/ oGoombaRelativeSpeed       OBJECT_FIELD_F32(0x21)
+#define /*0x120*/ oGoombaSize                OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oGoombaScale               OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oGoombaWalkTimer           OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oGoombaTargetYaw           OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oGoombaBlinkTimer          OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oGoombaTurningAwayFromWall OBJECT_FIELD_S32(0x20)
+#define /*0x138*/ oGoombaRelativeSpeed       OBJECT_FIELD_F32(0x21)
 
 /* Haunted Chair */
-#define /*0x0F4*/ oHauntedChairUnkF4  OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oHauntedChairUnkF8  OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oHauntedChairUnkFC  OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oHauntedChairUnk100 OBJECT_FIELD_S32P(0x1E)
-#define /*0x104*/ oHauntedChairUnk104 OBJECT_FIELD_S32(0x1F)
+#define /*0x120*/ oHauntedChairUnkF4  OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oHauntedChairUnkF8  OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oHauntedChairUnkFC  OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oHauntedChairUnk100 OBJECT_FIELD_S32P(0x1E)
+#define /*0x130*/ oHauntedChairUnk104 OBJECT_FIELD_S32(0x1F)
 
 /* Heave-Ho */
-#define /*0x088*/ oHeaveHoUnk88 OBJECT_FIELD_S32(0x00)
-#define /*0x0F4*/ oHeaveHoUnkF4 OBJECT_FIELD_F32(0x1B)
+#define /*0x0B4*/ oHeaveHoUnk88 OBJECT_FIELD_S32(0x00)
+#define /*0x120*/ oHeaveHoUnkF4 OBJECT_FIELD_F32(0x1B)
 
 /* Hidden Object */
-#define /*0x0F4*/ oHiddenObjectPurpleSwitch OBJECT_FIELD_OBJ(0x1B)
+#define /*0x120*/ oHiddenObjectPurpleSwitch OBJECT_FIELD_OBJ(0x1B)
 
 /* Hoot */
-#define /*0x0F4*/ oHootAvailability     OBJECT_FIELD_S32(0x1B)
-#define /*0x110*/ oHootMarioReleaseTime OBJECT_FIELD_S32(0x22)
+#define /*0x120*/ oHootAvailability     OBJECT_FIELD_S32(0x1B)
+#define /*0x13C*/ oHootMarioReleaseTime OBJECT_FIELD_S32(0x22)
 
 /* Horizontal Movement */
-#define /*0x0F4*/ oHorizontalMovementUnkF4  OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oHorizontalMovementUnkF8  OBJECT_FIELD_S32(0x1C)
-#define /*0x100*/ oHorizontalMovementUnk100 OBJECT_FIELD_F32(0x1E)
-#define /*0x104*/ oHorizontalMovementUnk104 OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oHorizontalMovementUnk108 OBJECT_FIELD_F32(0x20)
+#define /*0x120*/ oHorizontalMovementUnkF4  OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oHorizontalMovementUnkF8  OBJECT_FIELD_S32(0x1C)
+#define /*0x12C*/ oHorizontalMovementUnk100 OBJECT_FIELD_F32(0x1E)
+#define /*0x130*/ oHorizontalMovementUnk104 OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oHorizontalMovementUnk108 OBJECT_FIELD_F32(0x20)
 
 /* Kickable Board */
-#define /*0x0F4*/ oKickableBoardF4 OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oKickableBoardF8 OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oKickableBoardF4 OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oKickableBoardF8 OBJECT_FIELD_S32(0x1C)
 
  /* King Bob-omb */
-#define /*0x088*/ oKingBobombUnk88  OBJECT_FIELD_S32(0x00)
-#define /*0x0F8*/ oKingBobombUnkF8  OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oKingBobombUnkFC  OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oKingBobombUnk100 OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oKingBobombUnk104 OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oKingBobombUnk108 OBJECT_FIELD_S32(0x20)
+#define /*0x0B4*/ oKingBobombUnk88  OBJECT_FIELD_S32(0x00)
+#define /*0x124*/ oKingBobombUnkF8  OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oKingBobombUnkFC  OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oKingBobombUnk100 OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oKingBobombUnk104 OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oKingBobombUnk108 OBJECT_FIELD_S32(0x20)
 
 /* Klepto */
-#define /*0x0F4*/ oKleptoDistanceToTarget      OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oKleptoUnkF8                 OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oKleptoUnkFC                 OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oKleptoSpeed                 OBJECT_FIELD_F32(0x1E)
-#define /*0x104*/ oKleptoStartPosX             OBJECT_FIELD_F32(0x1F)
-#define /*0x108*/ oKleptoStartPosY             OBJECT_FIELD_F32(0x20)
-#define /*0x10C*/ oKleptoStartPosZ             OBJECT_FIELD_F32(0x21)
-#define /*0x110*/ oKleptoTimeUntilTargetChange OBJECT_FIELD_S32(0x22)
-#define /*0x1AC*/ oKleptoTargetNumber          OBJECT_FIELD_S16(0x49, 0)
-#define /*0x1AE*/ oKleptoUnk1AE                OBJECT_FIELD_S16(0x49, 1)
-#define /*0x1B0*/ oKleptoUnk1B0                OBJECT_FIELD_S16(0x4A, 0)
-#define /*0x1B2*/ oKleptoYawToTarget           OBJECT_FIELD_S16(0x4A, 1)
+#define /*0x120*/ oKleptoDistanceToTarget      OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oKleptoUnkF8                 OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oKleptoUnkFC                 OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oKleptoSpeed                 OBJECT_FIELD_F32(0x1E)
+#define /*0x130*/ oKleptoStartPosX             OBJECT_FIELD_F32(0x1F)
+#define /*0x134*/ oKleptoStartPosY             OBJECT_FIELD_F32(0x20)
+#define /*0x138*/ oKleptoStartPosZ             OBJECT_FIELD_F32(0x21)
+#define /*0x13C*/ oKleptoTimeUntilTargetChange OBJECT_FIELD_S32(0x22)
+#define /*0x1D8*/ oKleptoTargetNumber          OBJECT_FIELD_S16(0x49, 0)
+#define /*0x1DA*/ oKleptoUnk1AE                OBJECT_FIELD_S16(0x49, 1)
+#define /*0x1DC*/ oKleptoUnk1B0                OBJECT_FIELD_S16(0x4A, 0)
+#define /*0x1DE*/ oKleptoYawToTarget           OBJECT_FIELD_S16(0x4A, 1)
 
 /* Koopa */
-#define /*0x0F4*/ oKoopaAgility                     OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oKoopaMovementType                OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oKoopaTargetYaw                   OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oKoopaUnshelledTimeUntilTurn      OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oKoopaTurningAwayFromWall         OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oKoopaDistanceToMario             OBJECT_FIELD_F32(0x20)
-#define /*0x10C*/ oKoopaAngleToMario                OBJECT_FIELD_S32(0x21)
-#define /*0x110*/ oKoopaBlinkTimer                  OBJECT_FIELD_S32(0x22)
-#define /*0x1AC*/ oKoopaCountdown                   OBJECT_FIELD_S16(0x49, 0)
-#define /*0x1AE*/ oKoopaTheQuickRaceIndex           OBJECT_FIELD_S16(0x49, 1)
-#define /*0x1B0*/ oKoopaTheQuickInitTextboxCooldown OBJECT_FIELD_S16(0x4A, 0)
+#define /*0x120*/ oKoopaAgility                     OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oKoopaMovementType                OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oKoopaTargetYaw                   OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oKoopaUnshelledTimeUntilTurn      OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oKoopaTurningAwayFromWall         OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oKoopaDistanceToMario             OBJECT_FIELD_F32(0x20)
+#define /*0x138*/ oKoopaAngleToMario                OBJECT_FIELD_S32(0x21)
+#define /*0x13C*/ oKoopaBlinkTimer                  OBJECT_FIELD_S32(0x22)
+#define /*0x1D8*/ oKoopaCountdown                   OBJECT_FIELD_S16(0x49, 0)
+#define /*0x1DA*/ oKoopaTheQuickRaceIndex           OBJECT_FIELD_S16(0x49, 1)
+#define /*0x1DC*/ oKoopaTheQuickInitTextboxCooldown OBJECT_FIELD_S16(0x4A, 0)
 // 0x1D-0x21 for koopa the quick reserved for pathing
 
 /* Koopa Race Endpoint */
-#define /*0x0F4*/ oKoopaRaceEndpointRaceBegun     OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oKoopaRaceEndpointKoopaFinished OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oKoopaRaceEndpointRaceStatus    OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oKoopaRaceEndpointDialog        OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oKoopaRaceEndpointRaceEnded     OBJECT_FIELD_S32(0x1F)
+#define /*0x120*/ oKoopaRaceEndpointRaceBegun     OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oKoopaRaceEndpointKoopaFinished OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oKoopaRaceEndpointRaceStatus    OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oKoopaRaceEndpointDialog        OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oKoopaRaceEndpointRaceEnded     OBJECT_FIELD_S32(0x1F)
 
 /* Koopa Shell Flame */
-#define /*0x0F4*/ oKoopaShellFlameUnkF4 OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oKoopaShellFlameScale OBJECT_FIELD_F32(0x1C)
+#define /*0x120*/ oKoopaShellFlameUnkF4 OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oKoopaShellFlameScale OBJECT_FIELD_F32(0x1C)
 
 /* Camera Lakitu */
-#define /*0x0F4*/ oCameraLakituBlinkTimer     OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oCameraLakituSpeed          OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oCameraLakituCircleRadius   OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oCameraLakituFinishedDialog OBJECT_FIELD_S32(0x1E)
-#define /*0x1AC*/ oCameraLakituPitchVel       OBJECT_FIELD_S16(0x49, 0)
-#define /*0x1AE*/ oCameraLakituYawVel         OBJECT_FIELD_S16(0x49, 1)
+#define /*0x120*/ oCameraLakituBlinkTimer     OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oCameraLakituSpeed          OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oCameraLakituCircleRadius   OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oCameraLakituFinishedDialog OBJECT_FIELD_S32(0x1E)
+#define /*0x1D8*/ oCameraLakituPitchVel       OBJECT_FIELD_S16(0x49, 0)
+#define /*0x1DA*/ oCameraLakituYawVel         OBJECT_FIELD_S16(0x49, 1)
 
 /* Evil Lakitu */
-#define /*0x0F4*/ oEnemyLakituNumSpinies           OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oEnemyLakituBlinkTimer           OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oEnemyLakituSpinyCooldown        OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oEnemyLakituFaceForwardCountdown OBJECT_FIELD_S32(0x1E)
+#define /*0x120*/ oEnemyLakituNumSpinies           OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oEnemyLakituBlinkTimer           OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oEnemyLakituSpinyCooldown        OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oEnemyLakituFaceForwardCountdown OBJECT_FIELD_S32(0x1E)
 
 /* Intro Cutscene Lakitu */
-#define /*0x0F8*/ oIntroLakituSplineSegmentProgress OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oIntroLakituSplineSegment         OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oIntroLakituUnk100                OBJECT_FIELD_F32(0x1E)
-#define /*0x104*/ oIntroLakituUnk104                OBJECT_FIELD_F32(0x1F)
-#define /*0x108*/ oIntroLakituUnk108                OBJECT_FIELD_F32(0x20)
-#define /*0x10C*/ oIntroLakituUnk10C                OBJECT_FIELD_F32(0x21)
-#define /*0x110*/ oIntroLakituUnk110                OBJECT_FIELD_F32(0x22)
-#define /*0x1AC*/ oIntroLakituCloud                 OBJECT_FIELD_OBJ(0x49)
+#define /*0x124*/ oIntroLakituSplineSegmentProgress OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oIntroLakituSplineSegment         OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oIntroLakituUnk100                OBJECT_FIELD_F32(0x1E)
+#define /*0x130*/ oIntroLakituUnk104                OBJECT_FIELD_F32(0x1F)
+#define /*0x134*/ oIntroLakituUnk108                OBJECT_FIELD_F32(0x20)
+#define /*0x138*/ oIntroLakituUnk10C                OBJECT_FIELD_F32(0x21)
+#define /*0x13C*/ oIntroLakituUnk110                OBJECT_FIELD_F32(0x22)
+#define /*0x1D8*/ oIntroLakituCloud                 OBJECT_FIELD_OBJ(0x49)
 
 /* Main Menu Button */
-#define /*0x0F4*/ oMenuButtonState       OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oMenuButtonTimer       OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oMenuButtonOrigPosX    OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oMenuButtonOrigPosY    OBJECT_FIELD_F32(0x1E)
-#define /*0x104*/ oMenuButtonOrigPosZ    OBJECT_FIELD_F32(0x1F)
-#define /*0x108*/ oMenuButtonScale       OBJECT_FIELD_F32(0x20)
-#define /*0x10C*/ oMenuButtonActionPhase OBJECT_FIELD_S32(0x21)
+#define /*0x120*/ oMenuButtonState       OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oMenuButtonTimer       OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oMenuButtonOrigPosX    OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oMenuButtonOrigPosY    OBJECT_FIELD_F32(0x1E)
+#define /*0x130*/ oMenuButtonOrigPosZ    OBJECT_FIELD_F32(0x1F)
+#define /*0x134*/ oMenuButtonScale       OBJECT_FIELD_F32(0x20)
+#define /*0x138*/ oMenuButtonActionPhase OBJECT_FIELD_S32(0x21)
 
 /* Manta Ray */
-#define /*0x0F4*/ oMantaTargetPitch OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oMantaTargetYaw   OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oMantaTargetPitch OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oMantaTargetYaw   OBJECT_FIELD_S32(0x1C)
 
 /* Merry-Go-Round */
-#define /*0x088*/ oMerryGoRoundStopped         OBJECT_FIELD_S32(0x00)
-#define /*0x0F8*/ oMerryGoRoundMusicShouldPlay OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oMerryGoRoundMarioIsOutside  OBJECT_FIELD_S32(0x1D)
+#define /*0x0B4*/ oMerryGoRoundStopped         OBJECT_FIELD_S32(0x00)
+#define /*0x124*/ oMerryGoRoundMusicShouldPlay OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oMerryGoRoundMarioIsOutside  OBJECT_FIELD_S32(0x1D)
 
 /* Merry-Go-Round Boo Manager */
-#define /*0x088*/ oMerryGoRoundBooManagerNumBoosKilled  OBJECT_FIELD_S32(0x00)
-#define /*0x0FC*/ oMerryGoRoundBooManagerNumBoosSpawned OBJECT_FIELD_S32(0x1D)
+#define /*0x0B4*/ oMerryGoRoundBooManagerNumBoosKilled  OBJECT_FIELD_S32(0x00)
+#define /*0x128*/ oMerryGoRoundBooManagerNumBoosSpawned OBJECT_FIELD_S32(0x1D)
 
 /* Mips */
-#define /*0x0F4*/ oMipsStarStatus         OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oMipsStartWaypointIndex OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oMipsStarStatus         OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oMipsStartWaypointIndex OBJECT_FIELD_S32(0x1C)
  // 0x1D-0x21 reserved for pathing
-#define /*0x1AC*/ oMipsForwardVelocity    OBJECT_FIELD_F32(0x49)
+#define /*0x1D8*/ oMipsForwardVelocity    OBJECT_FIELD_F32(0x49)
 
 /* Moneybag */
-#define /*0x0F4*/ oMoneybagJumpState OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oMoneybagJumpState OBJECT_FIELD_S32(0x1B)
 
 /* Monty Mole */
-#define /*0x0F4*/ oMontyMoleCurrentHole           OBJECT_FIELD_OBJ(0x1B)
-#define /*0x0F8*/ oMontyMoleHeightRelativeToFloor OBJECT_FIELD_F32(0x1C)
+#define /*0x120*/ oMontyMoleCurrentHole           OBJECT_FIELD_OBJ(0x1B)
+#define /*0x124*/ oMontyMoleHeightRelativeToFloor OBJECT_FIELD_F32(0x1C)
 
 /* Monty Mole Hole */
-#define /*0x0F4*/ oMontyMoleHoleCooldown OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oMontyMoleHoleCooldown OBJECT_FIELD_S32(0x1B)
 
 /* Mr. Blizzard */
-#define /*0x0F4*/ oMrBlizzardScale             OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oMrBlizzardHeldObj           OBJECT_FIELD_OBJ(0x1C)
-#define /*0x0FC*/ oMrBlizzardGraphYVel         OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oMrBlizzardTimer             OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oMrBlizzardDizziness         OBJECT_FIELD_F32(0x1F)
-#define /*0x108*/ oMrBlizzardChangeInDizziness OBJECT_FIELD_F32(0x20)
-#define /*0x10C*/ oMrBlizzardGraphYOffset      OBJECT_FIELD_F32(0x21)
-#define /*0x110*/ oMrBlizzardDistFromHome      OBJECT_FIELD_S32(0x22)
-#define /*0x1AC*/ oMrBlizzardTargetMoveYaw     OBJECT_FIELD_S32(0x49)
+#define /*0x120*/ oMrBlizzardScale             OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oMrBlizzardHeldObj           OBJECT_FIELD_OBJ(0x1C)
+#define /*0x128*/ oMrBlizzardGraphYVel         OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oMrBlizzardTimer             OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oMrBlizzardDizziness         OBJECT_FIELD_F32(0x1F)
+#define /*0x134*/ oMrBlizzardChangeInDizziness OBJECT_FIELD_F32(0x20)
+#define /*0x138*/ oMrBlizzardGraphYOffset      OBJECT_FIELD_F32(0x21)
+#define /*0x13C*/ oMrBlizzardDistFromHome      OBJECT_FIELD_S32(0x22)
+#define /*0x1D8*/ oMrBlizzardTargetMoveYaw     OBJECT_FIELD_S32(0x49)
 
 /* Mr. I */
-#define /*0x0F4*/ oMrIUnkF4  OBJECT_FIELD_S32(0x1B)
-#define /*0x0FC*/ oMrIUnkFC  OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oMrIUnk100 OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oMrIUnk104 OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oMrIUnk108 OBJECT_FIELD_S32(0x20)
-#define /*0x10C*/ oMrIScale  OBJECT_FIELD_F32(0x21)
-#define /*0x110*/ oMrIUnk110 OBJECT_FIELD_S32(0x22)
+#define /*0x120*/ oMrIUnkF4  OBJECT_FIELD_S32(0x1B)
+#define /*0x128*/ oMrIUnkFC  OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oMrIUnk100 OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oMrIUnk104 OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oMrIUnk108 OBJECT_FIELD_S32(0x20)
+#define /*0x138*/ oMrIScale  OBJECT_FIELD_F32(0x21)
+#define /*0x13C*/ oMrIUnk110 OBJECT_FIELD_S32(0x22)
 
 /* Object Respawner */
-#define /*0x0F4*/ oRespawnerModelToRespawn    OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oRespawnerMinSpawnDist      OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oRespawnerBehaviorToRespawn OBJECT_FIELD_CVPTR(0x1D)
+#define /*0x120*/ oRespawnerModelToRespawn    OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oRespawnerMinSpawnDist      OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oRespawnerBehaviorToRespawn OBJECT_FIELD_CVPTR(0x1D)
 
 /* Openable Grill */
-#define /*0x088*/ oOpenableGrillUnk88        OBJECT_FIELD_S32(0x00)
-#define /*0x0F4*/ oOpenableGrillPurpleSwitch OBJECT_FIELD_OBJ(0x1B)
+#define /*0x0B4*/ oOpenableGrillUnk88        OBJECT_FIELD_S32(0x00)
+#define /*0x120*/ oOpenableGrillPurpleSwitch OBJECT_FIELD_OBJ(0x1B)
 
 /* Intro Cutscene Peach */
-#define /*0x108*/ oIntroPeachYawFromFocus OBJECT_FIELD_F32(0x20)
-#define /*0x10C*/ oIntroPeachPitchFromFocus OBJECT_FIELD_F32(0x21)
-#define /*0x110*/ oIntroPeachDistToCamera OBJECT_FIELD_F32(0x22)
+#define /*0x134*/ oIntroPeachYawFromFocus OBJECT_FIELD_F32(0x20)
+#define /*0x138*/ oIntroPeachPitchFromFocus OBJECT_FIELD_F32(0x21)
+#define /*0x13C*/ oIntroPeachDistToCamera OBJECT_FIELD_F32(0x22)
 
 /* Racing Penguin */
-#define /*0x0F4*/ oRacingPenguinInitTextCooldown       OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oRacingPenguinInitTextCooldown       OBJECT_FIELD_S32(0x1B)
 // 0x1D-0x21 reserved for pathing
-#define /*0x110*/ oRacingPenguinWeightedNewTargetSpeed OBJECT_FIELD_F32(0x22)
-#define /*0x1AC*/ oRacingPenguinFinalTextbox           OBJECT_FIELD_S16(0x49, 0)
-#define /*0x1AE*/ oRacingPenguinMarioWon               OBJECT_FIELD_S16(0x49, 1)
-#define /*0x1B0*/ oRacingPenguinReachedBottom          OBJECT_FIELD_S16(0x4A, 0)
-#define /*0x1B2*/ oRacingPenguinMarioCheated           OBJECT_FIELD_S16(0x4A, 1)
+#define /*0x13C*/ oRacingPenguinWeightedNewTargetSpeed OBJECT_FIELD_F32(0x22)
+#define /*0x1D8*/ oRacingPenguinFinalTextbox           OBJECT_FIELD_S16(0x49, 0)
+#define /*0x1DA*/ oRacingPenguinMarioWon               OBJECT_FIELD_S16(0x49, 1)
+#define /*0x1DC*/ oRacingPenguinReachedBottom          OBJECT_FIELD_S16(0x4A, 0)
+#define /*0x1DE*/ oRacingPenguinMarioCheated           OBJECT_FIELD_S16(0x4A, 1)
 
 /* Small Penguin */
-#define /*0x088*/ oSmallPenguinUnk88  OBJECT_FIELD_S32(0x00)
-#define /*0x100*/ oSmallPenguinUnk100 OBJECT_FIELD_S32(0x1E) // angle?
-#define /*0x104*/ oSmallPenguinUnk104 OBJECT_FIELD_F32(0x1F)
-#define /*0x108*/ oSmallPenguinUnk108 OBJECT_FIELD_F32(0x20)
-#define /*0x110*/ oSmallPenguinUnk110 OBJECT_FIELD_S32(0x22)
+#define /*0x0B4*/ oSmallPenguinUnk88  OBJECT_FIELD_S32(0x00)
+#define /*0x12C*/ oSmallPenguinUnk100 OBJECT_FIELD_S32(0x1E) // angle?
+#define /*0x130*/ oSmallPenguinUnk104 OBJECT_FIELD_F32(0x1F)
+#define /*0x134*/ oSmallPenguinUnk108 OBJECT_FIELD_F32(0x20)
+#define /*0x13C*/ oSmallPenguinUnk110 OBJECT_FIELD_S32(0x22)
 
 /* SL Walking Penguin */
-#define /*0x100*/ oSLWalkingPenguinWindCollisionXPos OBJECT_FIELD_F32(0x1E)
-#define /*0x104*/ oSLWalkingPenguinWindCollisionZPos OBJECT_FIELD_F32(0x1F)
-#define /*0x10C*/ oSLWalkingPenguinCurStep           OBJECT_FIELD_S32(0x21)
-#define /*0x110*/ oSLWalkingPenguinCurStepTimer      OBJECT_FIELD_S32(0x22)
+#define /*0x12C*/ oSLWalkingPenguinWindCollisionXPos OBJECT_FIELD_F32(0x1E)
+#define /*0x130*/ oSLWalkingPenguinWindCollisionZPos OBJECT_FIELD_F32(0x1F)
+#define /*0x138*/ oSLWalkingPenguinCurStep           OBJECT_FIELD_S32(0x21)
+#define /*0x13C*/ oSLWalkingPenguinCurStepTimer      OBJECT_FIELD_S32(0x22)
 
 /* Piranha Plant */
-#define /*0x0F4*/ oPiranhaPlantSleepMusicState OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oPiranhaPlantScale           OBJECT_FIELD_F32(0x1C)
+#define /*0x120*/ oPiranhaPlantSleepMusicState OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oPiranhaPlantScale           OBJECT_FIELD_F32(0x1C)
 
 /* Fire Piranha Plant */
-#define /*0x0F4*/ oFirePiranhaPlantNeutralScale   OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oFirePiranhaPlantScale          OBJECT_FIELD_F32(0x1C) // Shared with above obj? Coincidence?
-#define /*0x0FC*/ oFirePiranhaPlantActive         OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oFirePiranhaPlantDeathSpinTimer OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oFirePiranhaPlantDeathSpinVel   OBJECT_FIELD_F32(0x1F)
+#define /*0x120*/ oFirePiranhaPlantNeutralScale   OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oFirePiranhaPlantScale          OBJECT_FIELD_F32(0x1C) // Shared with above obj? Coincidence?
+#define /*0x128*/ oFirePiranhaPlantActive         OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oFirePiranhaPlantDeathSpinTimer OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oFirePiranhaPlantDeathSpinVel   OBJECT_FIELD_F32(0x1F)
 
 /* Pitoune */
-#define /*0x0F4*/ oPitouneUnkF4 OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oPitouneUnkF8 OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oPitouneUnkFC OBJECT_FIELD_F32(0x1D)
+#define /*0x120*/ oPitouneUnkF4 OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oPitouneUnkF8 OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oPitouneUnkFC OBJECT_FIELD_F32(0x1D)
 
 /* Falling Rising BitFS Platform */
-#define /*0x0F4*/ oBitFSPlatformTimer   OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oBitFSPlatformTimer   OBJECT_FIELD_S32(0x1B)
 
 /* Falling Bowser BitS Platform */
-#define /*0x0F8*/ oBitSPlatformBowser   OBJECT_FIELD_OBJ(0x1C)
-#define /*0x0FC*/ oBitSPlatformTimer    OBJECT_FIELD_S32(0x1D)
+#define /*0x124*/ oBitSPlatformBowser   OBJECT_FIELD_OBJ(0x1C)
+#define /*0x128*/ oBitSPlatformTimer    OBJECT_FIELD_S32(0x1D)
 
 /* WF Platform */
-#define /*0x10C*/ oPlatformUnk10C OBJECT_FIELD_F32(0x21)
-#define /*0x110*/ oPlatformUnk110 OBJECT_FIELD_F32(0x22)
+#define /*0x138*/ oPlatformUnk10C OBJECT_FIELD_F32(0x21)
+#define /*0x13C*/ oPlatformUnk110 OBJECT_FIELD_F32(0x22)
 
 /* Platform on Tracks */
-#define /*0x088*/ oPlatformOnTrackBaseBallIndex          OBJECT_FIELD_S32(0x00)
-#define /*0x0F4*/ oPlatformOnTrackDistMovedSinceLastBall OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oPlatformOnTrackSkiLiftRollVel         OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oPlatformOnTrackStartWaypoint          OBJECT_FIELD_WAYPOINT(0x1D)
-#define /*0x100*/ oPlatformOnTrackPrevWaypoint           OBJECT_FIELD_WAYPOINT(0x1E)
-#define /*0x104*/ oPlatformOnTrackPrevWaypointFlags      OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oPlatformOnTrackPitch                  OBJECT_FIELD_S32(0x20)
-#define /*0x10C*/ oPlatformOnTrackYaw                    OBJECT_FIELD_S32(0x21)
-#define /*0x110*/ oPlatformOnTrackOffsetY                OBJECT_FIELD_F32(0x22)
-#define /*0x1AC*/ oPlatformOnTrackIsNotSkiLift           OBJECT_FIELD_S16(0x49, 0)
-#define /*0x1AE*/ oPlatformOnTrackIsNotHMC               OBJECT_FIELD_S16(0x49, 1)
-#define /*0x1B0*/ oPlatformOnTrackType                   OBJECT_FIELD_S16(0x4A, 0)
-#define /*0x1B2*/ oPlatformOnTrackWasStoodOn             OBJECT_FIELD_S16(0x4A, 1)
+#define /*0x0B4*/ oPlatformOnTrackBaseBallIndex          OBJECT_FIELD_S32(0x00)
+#define /*0x120*/ oPlatformOnTrackDistMovedSinceLastBall OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oPlatformOnTrackSkiLiftRollVel         OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oPlatformOnTrackStartWaypoint          OBJECT_FIELD_WAYPOINT(0x1D)
+#define /*0x12C*/ oPlatformOnTrackPrevWaypoint           OBJECT_FIELD_WAYPOINT(0x1E)
+#define /*0x130*/ oPlatformOnTrackPrevWaypointFlags      OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oPlatformOnTrackPitch                  OBJECT_FIELD_S32(0x20)
+#define /*0x138*/ oPlatformOnTrackYaw                    OBJECT_FIELD_S32(0x21)
+#define /*0x13C*/ oPlatformOnTrackOffsetY                OBJECT_FIELD_F32(0x22)
+#define /*0x1D8*/ oPlatformOnTrackIsNotSkiLift           OBJECT_FIELD_S16(0x49, 0)
+#define /*0x1DA*/ oPlatformOnTrackIsNotHMC               OBJECT_FIELD_S16(0x49, 1)
+#define /*0x1DC*/ oPlatformOnTrackType                   OBJECT_FIELD_S16(0x4A, 0)
+#define /*0x1DE*/ oPlatformOnTrackWasStoodOn             OBJECT_FIELD_S16(0x4A, 1)
 
 /* Platform Spawner */
-#define /*0x0F4*/ oPlatformSpawnerUnkF4  OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oPlatformSpawnerUnkF8  OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oPlatformSpawnerUnkFC  OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oPlatformSpawnerUnk100 OBJECT_FIELD_F32(0x1E)
-#define /*0x104*/ oPlatformSpawnerUnk104 OBJECT_FIELD_F32(0x1F)
-#define /*0x108*/ oPlatformSpawnerUnk108 OBJECT_FIELD_F32(0x20)
+#define /*0x120*/ oPlatformSpawnerUnkF4  OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oPlatformSpawnerUnkF8  OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oPlatformSpawnerUnkFC  OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oPlatformSpawnerUnk100 OBJECT_FIELD_F32(0x1E)
+#define /*0x130*/ oPlatformSpawnerUnk104 OBJECT_FIELD_F32(0x1F)
+#define /*0x134*/ oPlatformSpawnerUnk108 OBJECT_FIELD_F32(0x20)
 
 /* Pokey */
-#define /*0x0F4*/ oPokeyAliveBodyPartFlags  OBJECT_FIELD_U32(0x1B)
-#define /*0x0F8*/ oPokeyNumAliveBodyParts   OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oPokeyBottomBodyPartSize  OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oPokeyHeadWasKilled       OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oPokeyTargetYaw           OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oPokeyChangeTargetTimer   OBJECT_FIELD_S32(0x20)
-#define /*0x10C*/ oPokeyTurningAwayFromWall OBJECT_FIELD_S32(0x21)
+#define /*0x120*/ oPokeyAliveBodyPartFlags  OBJECT_FIELD_U32(0x1B)
+#define /*0x124*/ oPokeyNumAliveBodyParts   OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oPokeyBottomBodyPartSize  OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oPokeyHeadWasKilled       OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oPokeyTargetYaw           OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oPokeyChangeTargetTimer   OBJECT_FIELD_S32(0x20)
+#define /*0x138*/ oPokeyTurningAwayFromWall OBJECT_FIELD_S32(0x21)
 
 /* Pokey Body Part */
-#define /*0x0F8*/ oPokeyBodyPartDeathDelayAfterHeadKilled OBJECT_FIELD_S32(0x1C)
-#define /*0x110*/ oPokeyBodyPartBlinkTimer                OBJECT_FIELD_S32(0x22)
+#define /*0x124*/ oPokeyBodyPartDeathDelayAfterHeadKilled OBJECT_FIELD_S32(0x1C)
+#define /*0x13C*/ oPokeyBodyPartBlinkTimer                OBJECT_FIELD_S32(0x22)
 
 /* DDD Pole */
-#define /*0x0F4*/ oDDDPoleVel       OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oDDDPoleMaxOffset OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oDDDPoleOffset    OBJECT_FIELD_F32(0x1D)
+#define /*0x120*/ oDDDPoleVel       OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oDDDPoleMaxOffset OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oDDDPoleOffset    OBJECT_FIELD_F32(0x1D)
 
 /* Pyramid Top */
-#define /*0x0F4*/ oPyramidTopPillarsTouched OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oPyramidTopPillarsTouched OBJECT_FIELD_S32(0x1B)
 
 /* Pyramid Top Explosion */
-#define /*0x0F4*/ oPyramidTopFragmentsScale OBJECT_FIELD_F32(0x1B)
+#define /*0x120*/ oPyramidTopFragmentsScale OBJECT_FIELD_F32(0x1B)
 
 /* Rolling Log */
-#define /*0x0F4*/ oRollingLogUnkF4 OBJECT_FIELD_F32(0x1B)
+#define /*0x120*/ oRollingLogUnkF4 OBJECT_FIELD_F32(0x1B)
 
 /* LLL Rotating Hex Flame */
-#define /*0x0F4*/ oLLLRotatingHexFlameUnkF4 OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oLLLRotatingHexFlameUnkF8 OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oLLLRotatingHexFlameUnkFC OBJECT_FIELD_F32(0x1D)
+#define /*0x120*/ oLLLRotatingHexFlameUnkF4 OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oLLLRotatingHexFlameUnkF8 OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oLLLRotatingHexFlameUnkFC OBJECT_FIELD_F32(0x1D)
 
 /* Scuttlebug */
-#define /*0x0F4*/ oScuttlebugUnkF4 OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oScuttlebugUnkF8 OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oScuttlebugUnkFC OBJECT_FIELD_S32(0x1D)
+#define /*0x120*/ oScuttlebugUnkF4 OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oScuttlebugUnkF8 OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oScuttlebugUnkFC OBJECT_FIELD_S32(0x1D)
 
 /* Scuttlebug Spawner */
-#define /*0x088*/ oScuttlebugSpawnerUnk88 OBJECT_FIELD_S32(0x00)
-#define /*0x0F4*/ oScuttlebugSpawnerUnkF4 OBJECT_FIELD_S32(0x1B)
+#define /*0x0B4*/ oScuttlebugSpawnerUnk88 OBJECT_FIELD_S32(0x00)
+#define /*0x120*/ oScuttlebugSpawnerUnkF4 OBJECT_FIELD_S32(0x1B)
 
 /* Seesaw Platform */
-#define /*0x0F4*/ oSeesawPlatformPitchVel OBJECT_FIELD_F32(0x1B)
+#define /*0x120*/ oSeesawPlatformPitchVel OBJECT_FIELD_F32(0x1B)
 
 /* Ship Part 3 */
-#define /*0x0F4*/ oShipPart3UnkF4 OBJECT_FIELD_S32(0x1B) // angle?
-#define /*0x0F8*/ oShipPart3UnkF8 OBJECT_FIELD_S32(0x1C) // angle?
+#define /*0x120*/ oShipPart3UnkF4 OBJECT_FIELD_S32(0x1B) // angle?
+#define /*0x124*/ oShipPart3UnkF8 OBJECT_FIELD_S32(0x1C) // angle?
 
 /* Sink When Stepped On */
-#define /*0x104*/ oSinkWhenSteppedOnUnk104 OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oSinkWhenSteppedOnUnk108 OBJECT_FIELD_F32(0x20)
+#define /*0x130*/ oSinkWhenSteppedOnUnk104 OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oSinkWhenSteppedOnUnk108 OBJECT_FIELD_F32(0x20)
 
 /* Skeeter */
-#define /*0x0F4*/ oSkeeterTargetAngle         OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oSkeeterTurningAwayFromWall OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oSkeeterUnkFC               OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oSkeeterWaitTime            OBJECT_FIELD_S32(0x1E)
-#define /*0x1AC*/ oSkeeterUnk1AC              OBJECT_FIELD_S16(0x49, 0)
+#define /*0x120*/ oSkeeterTargetAngle         OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oSkeeterTurningAwayFromWall OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oSkeeterUnkFC               OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oSkeeterWaitTime            OBJECT_FIELD_S32(0x1E)
+#define /*0x1D8*/ oSkeeterUnk1AC              OBJECT_FIELD_S16(0x49, 0)
 
 /* JRB Sliding Box */
-#define /*0x0F4*/ oJRBSlidingBoxUnkF4 OBJECT_FIELD_OBJ(0x1B)
-#define /*0x0F8*/ oJRBSlidingBoxUnkF8 OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oJRBSlidingBoxUnkFC OBJECT_FIELD_F32(0x1D)
+#define /*0x120*/ oJRBSlidingBoxUnkF4 OBJECT_FIELD_OBJ(0x1B)
+#define /*0x124*/ oJRBSlidingBoxUnkF8 OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oJRBSlidingBoxUnkFC OBJECT_FIELD_F32(0x1D)
 
 /* WF Sliding Brick Platform */
-#define /*0x0F4*/ oWFSlidBrickPtfmMovVel OBJECT_FIELD_F32(0x1B)
+#define /*0x120*/ oWFSlidBrickPtfmMovVel OBJECT_FIELD_F32(0x1B)
 
 /* Smoke */
-#define /*0x0F4*/ oSmokeTimer OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oSmokeTimer OBJECT_FIELD_S32(0x1B)
 
 /* Snowman's Bottom */
-#define /*0x0F4*/ oSnowmansBottomScale  OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oSnowmansBottomUnkF8  OBJECT_FIELD_S32(0x1C)
-#define /*0x1AC*/ oSnowmansBottomUnk1AC OBJECT_FIELD_S32(0x49)
+#define /*0x120*/ oSnowmansBottomScale  OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oSnowmansBottomUnkF8  OBJECT_FIELD_S32(0x1C)
+#define /*0x1D8*/ oSnowmansBottomUnk1AC OBJECT_FIELD_S32(0x49)
 // 0x1D-0x21 reserved for pathing
 
 /* Snowman's Head */
-#define /*0x0F4*/ oSnowmansHeadDialogActive OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oSnowmansHeadDialogActive OBJECT_FIELD_S32(0x1B)
 
 /* Snowman Wind Blowing */
-#define /*0x0F4*/ oSLSnowmanWindOriginalYaw OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oSLSnowmanWindOriginalYaw OBJECT_FIELD_S32(0x1B)
 
 /* Snufit */
-#define /*0x0F4*/ oSnufitRecoil          OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oSnufitScale           OBJECT_FIELD_F32(0x1C)
-#define /*0x100*/ oSnufitCircularPeriod  OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oSnufitBodyScalePeriod OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oSnufitBodyBaseScale   OBJECT_FIELD_S32(0x20)
-#define /*0x10C*/ oSnufitBullets         OBJECT_FIELD_S32(0x21)
-#define /*0x1AC*/ oSnufitXOffset         OBJECT_FIELD_S16(0x49, 0)
-#define /*0x1AE*/ oSnufitYOffset         OBJECT_FIELD_S16(0x49, 1)
-#define /*0x1B0*/ oSnufitZOffset         OBJECT_FIELD_S16(0x4A, 0)
-#define /*0x1B2*/ oSnufitBodyScale       OBJECT_FIELD_S16(0x4A, 1)
+#define /*0x120*/ oSnufitRecoil          OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oSnufitScale           OBJECT_FIELD_F32(0x1C)
+#define /*0x12C*/ oSnufitCircularPeriod  OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oSnufitBodyScalePeriod OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oSnufitBodyBaseScale   OBJECT_FIELD_S32(0x20)
+#define /*0x138*/ oSnufitBullets         OBJECT_FIELD_S32(0x21)
+#define /*0x1D8*/ oSnufitXOffset         OBJECT_FIELD_S16(0x49, 0)
+#define /*0x1DA*/ oSnufitYOffset         OBJECT_FIELD_S16(0x49, 1)
+#define /*0x1DC*/ oSnufitZOffset         OBJECT_FIELD_S16(0x4A, 0)
+#define /*0x1DE*/ oSnufitBodyScale       OBJECT_FIELD_S16(0x4A, 1)
 
 /* Spindel */
-#define /*0x0F4*/ oSpindelUnkF4 OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oSpindelUnkF8 OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oSpindelUnkF4 OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oSpindelUnkF8 OBJECT_FIELD_S32(0x1C)
 
 /* Spinning Heart */
-#define /*0x0F4*/ oSpinningHeartTotalSpin   OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oSpinningHeartPlayedSound OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oSpinningHeartTotalSpin   OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oSpinningHeartPlayedSound OBJECT_FIELD_S32(0x1C)
 
 /* Spiny */
-#define /*0x0F4*/ oSpinyTimeUntilTurn       OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oSpinyTargetYaw           OBJECT_FIELD_S32(0x1C)
-#define /*0x100*/ oSpinyTurningAwayFromWall OBJECT_FIELD_S32(0x1E)
+#define /*0x120*/ oSpinyTimeUntilTurn       OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oSpinyTargetYaw           OBJECT_FIELD_S32(0x1C)
+#define /*0x12C*/ oSpinyTurningAwayFromWall OBJECT_FIELD_S32(0x1E)
 
 /* Sound Effect */
-#define /*0x0F4*/ oSoundEffectUnkF4 OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oSoundEffectUnkF4 OBJECT_FIELD_S32(0x1B)
 
 /* Star Spawn */
-#define /*0x0F4*/ oStarSpawnDisFromHome OBJECT_FIELD_F32(0x1B)
-#define /*0x0FC*/ oStarSpawnUnkFC       OBJECT_FIELD_F32(0x1D)
+#define /*0x120*/ oStarSpawnDisFromHome OBJECT_FIELD_F32(0x1B)
+#define /*0x128*/ oStarSpawnUnkFC       OBJECT_FIELD_F32(0x1D)
 
 /* Hidden Star */
 // Secrets/Red Coins
-#define /*0x0F4*/ oHiddenStarTriggerCounter OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oHiddenStarTriggerCounter OBJECT_FIELD_S32(0x1B)
 
 // Overall very difficult to determine usage, mostly stubbed code.
 /* Sparkle Spawn Star */
-#define /*0x1B0*/ oSparkleSpawnUnk1B0 OBJECT_FIELD_S32(0x4A)
+#define /*0x1DC*/ oSparkleSpawnUnk1B0 OBJECT_FIELD_S32(0x4A)
 
 /* Sealed Door Star */
-#define /*0x108*/ oUnlockDoorStarState  OBJECT_FIELD_U32(0x20)
-#define /*0x10C*/ oUnlockDoorStarTimer  OBJECT_FIELD_S32(0x21)
-#define /*0x110*/ oUnlockDoorStarYawVel OBJECT_FIELD_S32(0x22)
+#define /*0x134*/ oUnlockDoorStarState  OBJECT_FIELD_U32(0x20)
+#define /*0x138*/ oUnlockDoorStarTimer  OBJECT_FIELD_S32(0x21)
+#define /*0x13C*/ oUnlockDoorStarYawVel OBJECT_FIELD_S32(0x22)
 
 /* Celebration Star */
-#define /*0x0F4*/ oCelebStarUnkF4              OBJECT_FIELD_S32(0x1B)
-#define /*0x108*/ oCelebStarDiameterOfRotation OBJECT_FIELD_S32(0x20)
+#define /*0x120*/ oCelebStarUnkF4              OBJECT_FIELD_S32(0x1B)
+#define /*0x134*/ oCelebStarDiameterOfRotation OBJECT_FIELD_S32(0x20)
 
 /* Star Selector */
-#define /*0x0F4*/ oStarSelectorType  OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oStarSelectorTimer OBJECT_FIELD_S32(0x1C)
-#define /*0x108*/ oStarSelectorSize  OBJECT_FIELD_F32(0x20)
+#define /*0x120*/ oStarSelectorType  OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oStarSelectorTimer OBJECT_FIELD_S32(0x1C)
+#define /*0x134*/ oStarSelectorSize  OBJECT_FIELD_F32(0x20)
 
 /* Sushi Shark */
-#define /*0x0F4*/ oSushiSharkUnkF4 OBJECT_FIELD_S32(0x1B) // angle?
+#define /*0x120*/ oSushiSharkUnkF4 OBJECT_FIELD_S32(0x1B) // angle?
 
 /* Swing Platform */
-#define /*0x0F4*/ oSwingPlatformAngle OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oSwingPlatformSpeed OBJECT_FIELD_F32(0x1C)
+#define /*0x120*/ oSwingPlatformAngle OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oSwingPlatformSpeed OBJECT_FIELD_F32(0x1C)
 
 /* Swoop */
-#define /*0x0F4*/ oSwoopBonkCountdown OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oSwoopTargetPitch   OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oSwoopTargetYaw     OBJECT_FIELD_S32(0x1D)
+#define /*0x120*/ oSwoopBonkCountdown OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oSwoopTargetPitch   OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oSwoopTargetYaw     OBJECT_FIELD_S32(0x1D)
 
 /* Grindel or Thwomp */
-#define /*0x0F4*/ oGrindelThwompRandomTimer OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oGrindelThwompRandomTimer OBJECT_FIELD_S32(0x1B)
 
 /* Tilting Platform */
-#define /*0x0F4*/ oTiltingPyramidNormalX         OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oTiltingPyramidNormalY         OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oTiltingPyramidNormalZ         OBJECT_FIELD_F32(0x1D)
-#define /*0x10C*/ oTiltingPyramidMarioOnPlatform OBJECT_FIELD_S32(0x21)
+#define /*0x120*/ oTiltingPyramidNormalX         OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oTiltingPyramidNormalY         OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oTiltingPyramidNormalZ         OBJECT_FIELD_F32(0x1D)
+#define /*0x138*/ oTiltingPyramidMarioOnPlatform OBJECT_FIELD_S32(0x21)
 
 /* Toad Message */
-#define /*0x108*/ oToadMessageDialogID       OBJECT_FIELD_U32(0x20)
-#define /*0x10C*/ oToadMessageRecentlyTalked OBJECT_FIELD_S32(0x21)
-#define /*0x110*/ oToadMessageState          OBJECT_FIELD_S32(0x22)
+#define /*0x134*/ oToadMessageDialogID       OBJECT_FIELD_U32(0x20)
+#define /*0x138*/ oToadMessageRecentlyTalked OBJECT_FIELD_S32(0x21)
+#define /*0x13C*/ oToadMessageState          OBJECT_FIELD_S32(0x22)
 
 /* Tox Box */
-#define /*0x1AC*/ oToxBoxActionTable OBJECT_FIELD_VPTR(0x49)
-#define /*0x1B0*/ oToxBoxActionStep  OBJECT_FIELD_S32(0x4A)
+#define /*0x1D8*/ oToxBoxActionTable OBJECT_FIELD_VPTR(0x49)
+#define /*0x1DC*/ oToxBoxActionStep  OBJECT_FIELD_S32(0x4A)
 
 /* TTC Rotating Solid */
-#define /*0x0F4*/ oTTCRotatingSolidNumTurns      OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oTTCRotatingSolidNumSides      OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oTTCRotatingSolidRotationDelay OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oTTCRotatingSolidVelY          OBJECT_FIELD_F32(0x1E)
-#define /*0x104*/ oTTCRotatingSolidSoundTimer    OBJECT_FIELD_S32(0x1F)
+#define /*0x120*/ oTTCRotatingSolidNumTurns      OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oTTCRotatingSolidNumSides      OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oTTCRotatingSolidRotationDelay OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oTTCRotatingSolidVelY          OBJECT_FIELD_F32(0x1E)
+#define /*0x130*/ oTTCRotatingSolidSoundTimer    OBJECT_FIELD_S32(0x1F)
 
 /* TTC Pendulum */
-#define /*0x0F4*/ oTTCPendulumAccelDir   OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oTTCPendulumAngle      OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oTTCPendulumAngleVel   OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oTTCPendulumAngleAccel OBJECT_FIELD_F32(0x1E)
-#define /*0x104*/ oTTCPendulumDelay      OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oTTCPendulumSoundTimer OBJECT_FIELD_S32(0x20)
+#define /*0x120*/ oTTCPendulumAccelDir   OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oTTCPendulumAngle      OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oTTCPendulumAngleVel   OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oTTCPendulumAngleAccel OBJECT_FIELD_F32(0x1E)
+#define /*0x130*/ oTTCPendulumDelay      OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oTTCPendulumSoundTimer OBJECT_FIELD_S32(0x20)
 
 /* TTC Treadmill */
-#define /*0x0F4*/ oTTCTreadmillBigSurface      OBJECT_FIELD_S16P(0x1B)
-#define /*0x0F8*/ oTTCTreadmillSmallSurface    OBJECT_FIELD_S16P(0x1C)
-#define /*0x0FC*/ oTTCTreadmillSpeed           OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oTTCTreadmillTargetSpeed     OBJECT_FIELD_F32(0x1E)
-#define /*0x104*/ oTTCTreadmillTimeUntilSwitch OBJECT_FIELD_S32(0x1F)
+#define /*0x120*/ oTTCTreadmillBigSurface      OBJECT_FIELD_S16P(0x1B)
+#define /*0x124*/ oTTCTreadmillSmallSurface    OBJECT_FIELD_S16P(0x1C)
+#define /*0x128*/ oTTCTreadmillSpeed           OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oTTCTreadmillTargetSpeed     OBJECT_FIELD_F32(0x1E)
+#define /*0x130*/ oTTCTreadmillTimeUntilSwitch OBJECT_FIELD_S32(0x1F)
 
 /* TTC Moving Bar */
-#define /*0x0F4*/ oTTCMovingBarDelay        OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oTTCMovingBarStoppedTimer OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oTTCMovingBarOffset       OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oTTCMovingBarSpeed        OBJECT_FIELD_F32(0x1E)
-#define /*0x104*/ oTTCMovingBarStartOffset  OBJECT_FIELD_F32(0x1F)
+#define /*0x120*/ oTTCMovingBarDelay        OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oTTCMovingBarStoppedTimer OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oTTCMovingBarOffset       OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oTTCMovingBarSpeed        OBJECT_FIELD_F32(0x1E)
+#define /*0x130*/ oTTCMovingBarStartOffset  OBJECT_FIELD_F32(0x1F)
 
 /* TTC Cog */
-#define /*0x0F4*/ oTTCCogDir       OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oTTCCogSpeed     OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oTTCCogTargetVel OBJECT_FIELD_F32(0x1D)
+#define /*0x120*/ oTTCCogDir       OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oTTCCogSpeed     OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oTTCCogTargetVel OBJECT_FIELD_F32(0x1D)
 
 /* TTC Pit Block */
-#define /*0x0F4*/ oTTCPitBlockPeakY    OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oTTCPitBlockDir      OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oTTCPitBlockWaitTime OBJECT_FIELD_S32(0x1D)
+#define /*0x120*/ oTTCPitBlockPeakY    OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oTTCPitBlockDir      OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oTTCPitBlockWaitTime OBJECT_FIELD_S32(0x1D)
 
 /* TTC Elevator */
-#define /*0x0F4*/ oTTCElevatorDir      OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oTTCElevatorPeakY    OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oTTCElevatorMoveTime OBJECT_FIELD_S32(0x1D)
+#define /*0x120*/ oTTCElevatorDir      OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oTTCElevatorPeakY    OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oTTCElevatorMoveTime OBJECT_FIELD_S32(0x1D)
 
 /* TTC 2D Rotator */
-#define /*0x0F4*/ oTTC2DRotatorMinTimeUntilNextTurn OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oTTC2DRotatorTargetYaw            OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oTTC2DRotatorIncrement            OBJECT_FIELD_S32(0x1D)
-#define /*0x104*/ oTTC2DRotatorRandomDirTimer       OBJECT_FIELD_S32(0x1F)
-#define /*0x108*/ oTTC2DRotatorSpeed                OBJECT_FIELD_S32(0x20)
+#define /*0x120*/ oTTC2DRotatorMinTimeUntilNextTurn OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oTTC2DRotatorTargetYaw            OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oTTC2DRotatorIncrement            OBJECT_FIELD_S32(0x1D)
+#define /*0x130*/ oTTC2DRotatorRandomDirTimer       OBJECT_FIELD_S32(0x1F)
+#define /*0x134*/ oTTC2DRotatorSpeed                OBJECT_FIELD_S32(0x20)
 
 /* TTC Spinner */
-#define /*0x0F4*/ oTTCSpinnerDir     OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oTTCChangeDirTimer OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oTTCSpinnerDir     OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oTTCChangeDirTimer OBJECT_FIELD_S32(0x1C)
 
 /* Beta Trampoline */
-#define /*0x110*/ oBetaTrampolineMarioOnTrampoline OBJECT_FIELD_S32(0x22)
+#define /*0x13C*/ oBetaTrampolineMarioOnTrampoline OBJECT_FIELD_S32(0x22)
 
 /* Tree Snow or Leaf */
-#define /*0x0F4*/ oTreeSnowOrLeafUnkF4 OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oTreeSnowOrLeafUnkF8 OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oTreeSnowOrLeafUnkFC OBJECT_FIELD_S32(0x1D)
+#define /*0x120*/ oTreeSnowOrLeafUnkF4 OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oTreeSnowOrLeafUnkF8 OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oTreeSnowOrLeafUnkFC OBJECT_FIELD_S32(0x1D)
 
 /* Tumbling Bridge */
-#define /*0x0F4*/ oTumblingBridgeUnkF4 OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oTumblingBridgeUnkF4 OBJECT_FIELD_S32(0x1B)
 
 /* Tweester */
-#define /*0x0F4*/ oTweesterScaleTimer OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oTweesterUnused     OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oTweesterScaleTimer OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oTweesterUnused     OBJECT_FIELD_S32(0x1C)
 
 /* Ukiki */
-#define /*0x0F4*/ oUkikiTauntCounter   OBJECT_FIELD_S16(0x1B, 0)
-#define /*0x0F6*/ oUkikiTauntsToBeDone OBJECT_FIELD_S16(0x1B, 1)
+#define /*0x120*/ oUkikiTauntCounter   OBJECT_FIELD_S16(0x1B, 0)
+#define /*0x122*/ oUkikiTauntsToBeDone OBJECT_FIELD_S16(0x1B, 1)
 // 0x1D-0x21 reserved for pathing
-#define /*0x110*/ oUkikiChaseFleeRange OBJECT_FIELD_F32(0x22)
-#define /*0x1AC*/ oUkikiTextState      OBJECT_FIELD_S16(0x49, 0)
-#define /*0x1AE*/ oUkikiTextboxTimer   OBJECT_FIELD_S16(0x49, 1)
-#define /*0x1B0*/ oUkikiCageSpinTimer  OBJECT_FIELD_S16(0x4A, 0)
-#define /*0x1B2*/ oUkikiHasCap         OBJECT_FIELD_S16(0x4A, 1)
+#define /*0x13C*/ oUkikiChaseFleeRange OBJECT_FIELD_F32(0x22)
+#define /*0x1D8*/ oUkikiTextState      OBJECT_FIELD_S16(0x49, 0)
+#define /*0x1DA*/ oUkikiTextboxTimer   OBJECT_FIELD_S16(0x49, 1)
+#define /*0x1DC*/ oUkikiCageSpinTimer  OBJECT_FIELD_S16(0x4A, 0)
+#define /*0x1DE*/ oUkikiHasCap         OBJECT_FIELD_S16(0x4A, 1)
 
 /* Ukiki Cage*/
-#define /*0x088*/ oUkikiCageNextAction OBJECT_FIELD_S32(0x00)
+#define /*0x0B4*/ oUkikiCageNextAction OBJECT_FIELD_S32(0x00)
 
 /* Unagi */
-#define /*0x0F4*/ oUnagiUnkF4  OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oUnagiUnkF8  OBJECT_FIELD_F32(0x1C)
+#define /*0x120*/ oUnagiUnkF4  OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oUnagiUnkF8  OBJECT_FIELD_F32(0x1C)
 // 0x1D-0x21 reserved for pathing
-#define /*0x110*/ oUnagiUnk110 OBJECT_FIELD_F32(0x22)
-#define /*0x1AC*/ oUnagiUnk1AC OBJECT_FIELD_F32(0x49)
-#define /*0x1B0*/ oUnagiUnk1B0 OBJECT_FIELD_S16(0x4A, 0)
-#define /*0x1B2*/ oUnagiUnk1B2 OBJECT_FIELD_S16(0x4A, 1)
+#define /*0x13C*/ oUnagiUnk110 OBJECT_FIELD_F32(0x22)
+#define /*0x1D8*/ oUnagiUnk1AC OBJECT_FIELD_F32(0x49)
+#define /*0x1DC*/ oUnagiUnk1B0 OBJECT_FIELD_S16(0x4A, 0)
+#define /*0x1DE*/ oUnagiUnk1B2 OBJECT_FIELD_S16(0x4A, 1)
 
 /* Water Bomb */
-#define /*0x0F8*/ oWaterBombVerticalStretch OBJECT_FIELD_F32(0x1C)
-#define /*0x0FC*/ oWaterBombStretchSpeed    OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oWaterBombOnGround        OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oWaterBombNumBounces      OBJECT_FIELD_F32(0x1F)
+#define /*0x124*/ oWaterBombVerticalStretch OBJECT_FIELD_F32(0x1C)
+#define /*0x128*/ oWaterBombStretchSpeed    OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oWaterBombOnGround        OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oWaterBombNumBounces      OBJECT_FIELD_F32(0x1F)
 
 /* Water Bomb Spawner */
-#define /*0x0F4*/ oWaterBombSpawnerBombActive  OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oWaterBombSpawnerTimeToSpawn OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oWaterBombSpawnerBombActive  OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oWaterBombSpawnerTimeToSpawn OBJECT_FIELD_S32(0x1C)
 
 /* Water Bomb Cannon */
-#define /*0x0F4*/ oWaterCannonUnkF4  OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oWaterCannonUnkF8  OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oWaterCannonUnkFC  OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oWaterCannonUnk100 OBJECT_FIELD_S32(0x1E)
+#define /*0x120*/ oWaterCannonUnkF4  OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oWaterCannonUnkF8  OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oWaterCannonUnkFC  OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oWaterCannonUnk100 OBJECT_FIELD_S32(0x1E)
 
 /* Cannon Barrel Bubbles */
-#define /*0x0F4*/ oCannonBarrelBubblesUnkF4 OBJECT_FIELD_F32(0x1B)
+#define /*0x120*/ oCannonBarrelBubblesUnkF4 OBJECT_FIELD_F32(0x1B)
 
 /* Water Level Pillar */
-#define /*0x0F8*/ oWaterLevelPillarDrained OBJECT_FIELD_S32(0x1C)
+#define /*0x124*/ oWaterLevelPillarDrained OBJECT_FIELD_S32(0x1C)
 
 /* Water Level Trigger */
-#define /*0x0F4*/ oWaterLevelTriggerUnkF4            OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oWaterLevelTriggerTargetWaterLevel OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oWaterLevelTriggerUnkF4            OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oWaterLevelTriggerTargetWaterLevel OBJECT_FIELD_S32(0x1C)
 
 /* Water Objects */
-#define /*0x0F4*/ oWaterObjUnkF4  OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oWaterObjUnkF8  OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oWaterObjUnkFC  OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oWaterObjUnk100 OBJECT_FIELD_S32(0x1E)
+#define /*0x120*/ oWaterObjUnkF4  OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oWaterObjUnkF8  OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oWaterObjUnkFC  OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oWaterObjUnk100 OBJECT_FIELD_S32(0x1E)
 
 /* Water Ring (both variants) */
-#define /*0x0F4*/ oWaterRingScalePhaseX      OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oWaterRingScalePhaseY      OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oWaterRingScalePhaseZ      OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oWaterRingNormalX          OBJECT_FIELD_F32(0x1E)
-#define /*0x104*/ oWaterRingNormalY          OBJECT_FIELD_F32(0x1F)
-#define /*0x108*/ oWaterRingNormalZ          OBJECT_FIELD_F32(0x20)
-#define /*0x10C*/ oWaterRingMarioDistInFront OBJECT_FIELD_F32(0x21)
-#define /*0x110*/ oWaterRingIndex            OBJECT_FIELD_S32(0x22)
-#define /*0x1AC*/ oWaterRingAvgScale         OBJECT_FIELD_F32(0x49)
+#define /*0x120*/ oWaterRingScalePhaseX      OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oWaterRingScalePhaseY      OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oWaterRingScalePhaseZ      OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oWaterRingNormalX          OBJECT_FIELD_F32(0x1E)
+#define /*0x130*/ oWaterRingNormalY          OBJECT_FIELD_F32(0x1F)
+#define /*0x134*/ oWaterRingNormalZ          OBJECT_FIELD_F32(0x20)
+#define /*0x138*/ oWaterRingMarioDistInFront OBJECT_FIELD_F32(0x21)
+#define /*0x13C*/ oWaterRingIndex            OBJECT_FIELD_S32(0x22)
+#define /*0x1D8*/ oWaterRingAvgScale         OBJECT_FIELD_F32(0x49)
 
 /* Water Ring Spawner (Jet Stream Ring Spawner and Manta Ray) */
-#define /*0x1AC*/ oWaterRingSpawnerRingsCollected OBJECT_FIELD_S32(0x49)
+#define /*0x1D8*/ oWaterRingSpawnerRingsCollected OBJECT_FIELD_S32(0x49)
 
 /* Water Ring Manager (Jet Stream Ring Spawner and Manta Ray Ring Manager) */
-#define /*0x0F4*/ oWaterRingMgrNextRingIndex     OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oWaterRingMgrLastRingCollected OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oWaterRingMgrNextRingIndex     OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oWaterRingMgrLastRingCollected OBJECT_FIELD_S32(0x1C)
 
 /* Wave Trail */
-#define /*0x0F8*/ oWaveTrailSize OBJECT_FIELD_F32(0x1C)
+#define /*0x124*/ oWaveTrailSize OBJECT_FIELD_F32(0x1C)
 
 /* Whirlpool */
-#define /*0x0F4*/ oWhirlpoolInitFacePitch OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oWhirlpoolInitFaceRoll  OBJECT_FIELD_S32(0x1C)
+#define /*0x120*/ oWhirlpoolInitFacePitch OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oWhirlpoolInitFaceRoll  OBJECT_FIELD_S32(0x1C)
 
 /* White Puff Explode */
-#define /*0x0F4*/ oWhitePuffUnkF4 OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oWhitePuffUnkF8 OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oWhitePuffUnkFC OBJECT_FIELD_S32(0x1D)
+#define /*0x120*/ oWhitePuffUnkF4 OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oWhitePuffUnkF8 OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oWhitePuffUnkFC OBJECT_FIELD_S32(0x1D)
 
 /* White Wind Particle */
-#define /*0x0F4*/ oStrongWindParticlePenguinObj OBJECT_FIELD_OBJ(0x1B)
+#define /*0x120*/ oStrongWindParticlePenguinObj OBJECT_FIELD_OBJ(0x1B)
 
 /* Whomp */
-#define /*0x0F8*/ oWhompShakeVal OBJECT_FIELD_S32(0x1C)
+#define /*0x124*/ oWhompShakeVal OBJECT_FIELD_S32(0x1C)
 
 /* Wiggler */
-#define /*0x0F4*/ oWigglerFallThroughFloorsHeight OBJECT_FIELD_F32(0x1B)
-#define /*0x0F8*/ oWigglerSegments                OBJECT_FIELD_CHAIN_SEGMENT(0x1C)
-#define /*0x0FC*/ oWigglerWalkAnimSpeed           OBJECT_FIELD_F32(0x1D)
-#define /*0x104*/ oWigglerSquishSpeed             OBJECT_FIELD_F32(0x1F)
-#define /*0x108*/ oWigglerTimeUntilRandomTurn     OBJECT_FIELD_S32(0x20)
-#define /*0x10C*/ oWigglerTargetYaw               OBJECT_FIELD_S32(0x21)
-#define /*0x110*/ oWigglerWalkAwayFromWallTimer   OBJECT_FIELD_S32(0x22)
-#define /*0x1AC*/ oWigglerUnused                  OBJECT_FIELD_S16(0x49, 0)
-#define /*0x1AE*/ oWigglerTextStatus              OBJECT_FIELD_S16(0x49, 1)
+#define /*0x120*/ oWigglerFallThroughFloorsHeight OBJECT_FIELD_F32(0x1B)
+#define /*0x124*/ oWigglerSegments                OBJECT_FIELD_CHAIN_SEGMENT(0x1C)
+#define /*0x128*/ oWigglerWalkAnimSpeed           OBJECT_FIELD_F32(0x1D)
+#define /*0x130*/ oWigglerSquishSpeed             OBJECT_FIELD_F32(0x1F)
+#define /*0x134*/ oWigglerTimeUntilRandomTurn     OBJECT_FIELD_S32(0x20)
+#define /*0x138*/ oWigglerTargetYaw               OBJECT_FIELD_S32(0x21)
+#define /*0x13C*/ oWigglerWalkAwayFromWallTimer   OBJECT_FIELD_S32(0x22)
+#define /*0x1D8*/ oWigglerUnused                  OBJECT_FIELD_S16(0x49, 0)
+#define /*0x1DA*/ oWigglerTextStatus              OBJECT_FIELD_S16(0x49, 1)
 
 /* LLL Wood Piece */
-#define /*0x0F4*/ oLLLWoodPieceOscillationTimer OBJECT_FIELD_S32(0x1B)
+#define /*0x120*/ oLLLWoodPieceOscillationTimer OBJECT_FIELD_S32(0x1B)
 
 /* Wooden Post */
-#define /*0x0F4*/ oWoodenPostTotalMarioAngle  OBJECT_FIELD_S32(0x1B)
-#define /*0x0F8*/ oWoodenPostPrevAngleToMario OBJECT_FIELD_S32(0x1C)
-#define /*0x0FC*/ oWoodenPostSpeedY           OBJECT_FIELD_F32(0x1D)
-#define /*0x100*/ oWoodenPostMarioPounding    OBJECT_FIELD_S32(0x1E)
-#define /*0x104*/ oWoodenPostOffsetY          OBJECT_FIELD_F32(0x1F)
+#define /*0x120*/ oWoodenPostTotalMarioAngle  OBJECT_FIELD_S32(0x1B)
+#define /*0x124*/ oWoodenPostPrevAngleToMario OBJECT_FIELD_S32(0x1C)
+#define /*0x128*/ oWoodenPostSpeedY           OBJECT_FIELD_F32(0x1D)
+#define /*0x12C*/ oWoodenPostMarioPounding    OBJECT_FIELD_S32(0x1E)
+#define /*0x130*/ oWoodenPostOffsetY          OBJECT_FIELD_F32(0x1F)
 
 /* Yoshi */
-#define /*0x0F4*/ oYoshiBlinkTimer OBJECT_FIELD_S32(0x1B)
-#define /*0x0FC*/ oYoshiChosenHome OBJECT_FIELD_S32(0x1D)
-#define /*0x100*/ oYoshiTargetYaw  OBJECT_FIELD_S32(0x1E)
+#define /*0x120*/ oYoshiBlinkTimer OBJECT_FIELD_S32(0x1B)
+#define /*0x128*/ oYoshiChosenHome OBJECT_FIELD_S32(0x1D)
+#define /*0x12C*/ oYoshiTargetYaw  OBJECT_FIELD_S32(0x1E)
 
 #endif // OBJECT_FIELDS_H
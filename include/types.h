@@ -140,14 +140,30 @@ struct ObjectNode {
 // whether some of these pointers point to ObjectNode or Object.
 
 struct Object {
+    // Hot block: the fields read by object list processing, collision and
+    // rendering for every object, every frame, kept together ahead of the
+    // common object fields at the start of rawData.
     /*0x000*/ struct ObjectNode header;
     /*0x068*/ struct Object *parentObj;
-    /*0x06C*/ struct Object *prevObj;
+    /*0x06C*/ s16 activeFlags;
+    /*0x06E*/ s16 numCollidedObjs;
     /*0x070*/ u32 collidedObjInteractTypes;
-    /*0x074*/ s16 activeFlags;
-    /*0x076*/ s16 numCollidedObjs;
-    /*0x078*/ struct Object *collidedObjs[4];
-    /*0x088*/
+    /*0x074*/ struct Object *collidedObjs[4];
+    /*0x084*/ f32 hitboxRadius;
+    /*0x088*/ f32 hitboxHeight;
+    /*0x08C*/ f32 hurtboxRadius;
+    /*0x090*/ f32 hurtboxHeight;
+    /*0x094*/ f32 hitboxDownOffset;
+    /*0x098*/ const BehaviorScript *curBhvCommand;
+    /*0x09C*/ const BehaviorScript *behavior;
+    /*0x0A0*/ struct BhvDecodedScript *bhvDecodedScript;
+    /*0x0A4*/ struct Object *platform;
+    /*0x0A8*/ void *collisionData;
+    /*0x0AC*/ s16 sleepRule;   // 1 + index of the object's sleep rule, or 0 if it never sleeps
+    /*0x0AE*/ s16 sleepFrames; // frames skipped since the object last ticked while asleep
+    /*0x0B0*/ s16 bhvDelayTimer;
+    /*0x0B2*/ s16 respawnInfoType;
+    /*0x0B4*/
     union {
         // Object fields. See object_fields.h.
         u32 asU32[0x50];
@@ -179,21 +195,10 @@ struct Object {
         const void *asConstVoidPtr[0x50];
     } ptrData;
 #endif
-    /*0x1C8*/ u32 unused1;
-    /*0x1CC*/ const BehaviorScript *curBhvCommand;
-    /*0x1D0*/ u32 bhvStackIndex;
-    /*0x1D4*/ uintptr_t bhvStack[8];
-    /*0x1F4*/ s16 bhvDelayTimer;
-    /*0x1F6*/ s16 respawnInfoType;
-    /*0x1F8*/ f32 hitboxRadius;
-    /*0x1FC*/ f32 hitboxHeight;
-    /*0x200*/ f32 hurtboxRadius;
-    /*0x204*/ f32 hurtboxHeight;
-    /*0x208*/ f32 hitboxDownOffset;
-    /*0x20C*/ const BehaviorScript *behavior;
-    /*0x210*/ u32 unused2;
-    /*0x214*/ struct Object *platform;
-    /*0x218*/ void *collisionData;
+    // Cold block: fields only touched by specific commands and behaviors.
+    /*0x1F4*/ struct Object *prevObj;
+    /*0x1F8*/ u32 bhvStackIndex;
+    /*0x1FC*/ uintptr_t bhvStack[8];
     /*0x21C*/ Mat4 transform;
     /*0x25C*/ void *respawnInfo;
 };
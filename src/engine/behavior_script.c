@@ -396,6 +396,9 @@ static s32 bhv_cmd_set_int(void) {
     s16 value = BHV_CMD_GET_2ND_S16(0);
 
     cur_obj_set_int(field, value);
+    if (field == O_INTERACT_TYPE_INDEX) {
+        obj_update_time_stop_exemption(gCurrentObject);
+    }
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -752,6 +755,7 @@ static s32 bhv_cmd_set_home(void) {
 // Usage: SET_INTERACT_TYPE(type)
 static s32 bhv_cmd_set_interact_type(void) {
     gCurrentObject->oInteractType = BHV_CMD_GET_U32(1);
+    obj_update_time_stop_exemption(gCurrentObject);
 
     gCurBhvCommand += 2;
     return BHV_PROC_CONTINUE;
@@ -901,6 +905,478 @@ static BhvCommandProc BehaviorCmdTable[] = {
     bhv_cmd_spawn_water_droplet,
 };
 
+#ifdef BHV_SCRIPT_PREDECODE
+/**
+ * Pre-decoded behavior scripts.
+ *
+ * The first time an object runs a behavior script, the script is decoded into
+ * an array holding one BhvDecodedCmd per script word, so a raw command address
+ * maps to its decoded command with a subtraction. Operands are unpacked into
+ * ready-to-use values and segmented addresses are resolved once, and GOTO/CALL
+ * targets are linked to their decoded commands the first time the jump is taken.
+ *
+ * Decoded scripts are kept in an allocation-only pool that is reset when objects
+ * are cleared on level load. An object's curBhvCommand and behavior stack still
+ * hold raw script addresses, so code that redirects an object's script keeps
+ * working. If a script can't be decoded (e.g. the pool is full), the object
+ * falls back to the BehaviorCmdTable interpreter.
+ */
+
+// Commands the decoded interpreter handles itself. Anything else is run through
+// BehaviorCmdTable.
+#define BHV_OP_BEGIN               0x00
+#define BHV_OP_DELAY               0x01
+#define BHV_OP_CALL                0x02
+#define BHV_OP_RETURN              0x03
+#define BHV_OP_GOTO                0x04
+#define BHV_OP_BEGIN_REPEAT        0x05
+#define BHV_OP_END_REPEAT          0x06
+#define BHV_OP_END_REPEAT_CONTINUE 0x07
+#define BHV_OP_BEGIN_LOOP          0x08
+#define BHV_OP_END_LOOP            0x09
+#define BHV_OP_BREAK               0x0A
+#define BHV_OP_BREAK_UNUSED        0x0B
+#define BHV_OP_CALL_NATIVE         0x0C
+#define BHV_OP_ADD_FLOAT           0x0D
+#define BHV_OP_SET_FLOAT           0x0E
+#define BHV_OP_ADD_INT             0x0F
+#define BHV_OP_SET_INT             0x10
+#define BHV_OP_OR_INT              0x11
+#define BHV_OP_BIT_CLEAR           0x12
+#define BHV_OP_SET_MODEL           0x1B
+#define BHV_OP_DEACTIVATE          0x1D
+#define BHV_OP_BILLBOARD           0x21
+#define BHV_OP_HIDE                0x22
+#define BHV_OP_SET_HITBOX          0x23
+#define BHV_OP_LOAD_ANIMATIONS     0x27
+#define BHV_OP_LOAD_COLLISION_DATA 0x2A
+#define BHV_OP_SET_HOME            0x2D
+#define BHV_OP_SET_HURTBOX         0x2E
+#define BHV_OP_SET_INTERACT_TYPE   0x2F
+#define BHV_OP_SCALE               0x32
+#define BHV_OP_ANIMATE_TEXTURE     0x34
+
+// Longest script that will be decoded, in words.
+#define BHV_DECODE_MAX_LENGTH 0x400
+
+// Number of words taken by each behavior command.
+static u8 sBhvCmdLengths[] = {
+    /* 0x00 */ 1, 1, 2, 1, 2, 1, 1, 1,
+    /* 0x08 */ 1, 1, 1, 1, 2, 1, 1, 1,
+    /* 0x10 */ 1, 1, 1, 2, 2, 2, 2, 2,
+    /* 0x18 */ 1, 1, 1, 1, 3, 1, 1, 1,
+    /* 0x20 */ 1, 1, 1, 2, 1, 1, 1, 2,
+    /* 0x28 */ 1, 3, 2, 3, 3, 1, 2, 2,
+    /* 0x30 */ 5, 2, 1, 2, 1, 1, 2, 2,
+};
+
+struct BhvDecodedCmd {
+    u8 op;
+    u8 field; // 2nd byte of the first word
+    s16 arg;  // 2nd halfword of the first word
+    union {
+        s32 asS32;
+        f32 asF32;
+        void *asVoidPtr;
+        NativeBhvFunc asFunc;
+        struct BhvDecodedCmd *target; // GOTO/CALL, NULL until the jump is first taken
+    } value;
+    struct BhvDecodedScript *targetScript;
+};
+
+struct BhvDecodedScript {
+    const BehaviorScript *start;
+    const BehaviorScript *end; // one past the last decoded word
+    struct BhvDecodedCmd *cmds;
+    struct BhvDecodedScript *next;
+};
+
+// The raw script address of a decoded command.
+#define BHV_DECODED_ADDR(script, cmd) (&(script)->start[(cmd) - (script)->cmds])
+
+static struct AllocOnlyPool *sBhvDecodePool;
+static struct BhvDecodedScript *sBhvDecodedScripts;
+
+/**
+ * Return whether execution never falls through past the given command, which
+ * marks the end of the script being decoded.
+ */
+static s32 bhv_cmd_ends_script(s32 op) {
+    switch (op) {
+        case BHV_OP_RETURN:
+        case BHV_OP_GOTO:
+        case BHV_OP_END_LOOP:
+        case BHV_OP_BREAK:
+        case BHV_OP_BREAK_UNUSED:
+        case BHV_OP_DEACTIVATE:
+            return TRUE;
+    }
+    return FALSE;
+}
+
+/**
+ * Unpack the operands of a script command.
+ */
+static void bhv_decode_cmd(struct BhvDecodedCmd *dst, const BehaviorScript *cmd) {
+    s32 op = cmd[0] >> 24;
+
+    dst->op = op;
+    dst->field = (cmd[0] >> 16) & 0xFF;
+    dst->arg = (s16)(cmd[0] & 0xFFFF);
+    dst->value.asS32 = 0;
+    dst->targetScript = NULL;
+
+    switch (op) {
+        case BHV_OP_CALL:
+        case BHV_OP_GOTO:
+            dst->value.target = NULL;
+            break;
+        case BHV_OP_CALL_NATIVE:
+            dst->value.asFunc = (NativeBhvFunc) cmd[1];
+            break;
+        case BHV_OP_ADD_FLOAT:
+        case BHV_OP_SET_FLOAT:
+            dst->value.asF32 = dst->arg;
+            break;
+        case BHV_OP_OR_INT:
+            dst->value.asS32 = cmd[0] & 0xFFFF;
+            break;
+        case BHV_OP_BIT_CLEAR:
+            dst->value.asS32 = (cmd[0] & 0xFFFF) ^ 0xFFFF;
+            break;
+        case BHV_OP_SET_HITBOX:
+        case BHV_OP_SET_HURTBOX:
+            // Radius in arg, height in value.
+            dst->arg = (s16)(cmd[1] >> 16);
+            dst->value.asS32 = (s16)(cmd[1] & 0xFFFF);
+            break;
+        case BHV_OP_LOAD_ANIMATIONS:
+            dst->value.asVoidPtr = (void *) cmd[1];
+            break;
+        case BHV_OP_LOAD_COLLISION_DATA:
+            dst->value.asVoidPtr = segmented_to_virtual((void *) cmd[1]);
+            break;
+        case BHV_OP_SET_INTERACT_TYPE:
+            dst->value.asS32 = cmd[1];
+            break;
+        case BHV_OP_SCALE:
+            dst->value.asF32 = dst->arg / 100.0f;
+            break;
+    }
+}
+
+/**
+ * Decode the script starting at the given command, up to the first command
+ * that doesn't fall through. Return NULL if the script contains an unknown
+ * command, is too long, or doesn't fit in the pool.
+ */
+static struct BhvDecodedScript *bhv_decode_script(const BehaviorScript *start) {
+    struct BhvDecodedScript *script;
+    s32 length = 0;
+    s32 op;
+    s32 i;
+
+    if (sBhvDecodePool == NULL) {
+        return NULL;
+    }
+
+    do {
+        op = start[length] >> 24;
+        if (op >= ARRAY_COUNT(sBhvCmdLengths) || length >= BHV_DECODE_MAX_LENGTH) {
+            return NULL;
+        }
+        length += sBhvCmdLengths[op];
+    } while (!bhv_cmd_ends_script(op));
+
+    script = alloc_only_pool_alloc(sBhvDecodePool, sizeof(struct BhvDecodedScript)
+                                                       + length * sizeof(struct BhvDecodedCmd));
+    if (script == NULL) {
+        return NULL;
+    }
+
+    script->start = start;
+    script->end = start + length;
+    script->cmds = (struct BhvDecodedCmd *) (script + 1);
+
+    for (i = 0; i < length; i += sBhvCmdLengths[script->cmds[i].op]) {
+        bhv_decode_cmd(&script->cmds[i], &start[i]);
+    }
+
+    script->next = sBhvDecodedScripts;
+    sBhvDecodedScripts = script;
+
+    return script;
+}
+
+/**
+ * Return the decoded command for a raw script address, decoding the script
+ * from that address if no decoded script contains it yet. The script pointed
+ * to by scriptPtr is checked first, and is updated to the script containing
+ * the command. Return NULL if the command can't be decoded.
+ */
+static struct BhvDecodedCmd *bhv_decoded_cmd_at(struct BhvDecodedScript **scriptPtr,
+                                                const BehaviorScript *cmd) {
+    struct BhvDecodedScript *script = *scriptPtr;
+
+    if (script == NULL || cmd < script->start || cmd >= script->end) {
+        script = sBhvDecodedScripts;
+        while (script != NULL && (cmd < script->start || cmd >= script->end)) {
+            script = script->next;
+        }
+
+        if (script == NULL && (script = bhv_decode_script(cmd)) == NULL) {
+            return NULL;
+        }
+        *scriptPtr = script;
+    }
+
+    return &script->cmds[cmd - script->start];
+}
+
+/**
+ * Reset the decoded script cache. Called when objects are cleared on level load,
+ * since the scripts and the segments they reference may change.
+ */
+void clear_bhv_decode_cache(void) {
+    sBhvDecodePool = alloc_only_pool_init(BHV_DECODE_CACHE_SIZE, MEMORY_POOL_LEFT);
+    sBhvDecodedScripts = NULL;
+}
+
+/**
+ * Run the current object's behavior script from its decoded form, starting at
+ * gCurBhvCommand. Returns BHV_PROC_BREAK once the script is done for this frame,
+ * with gCurBhvCommand pointing to where it will continue next frame. Returns
+ * BHV_PROC_CONTINUE if execution reached a command that couldn't be decoded, in
+ * which case the caller should continue interpreting from gCurBhvCommand.
+ */
+static s32 cur_obj_run_decoded_script(void) {
+    struct Object *obj = gCurrentObject;
+    struct BhvDecodedScript *script = obj->bhvDecodedScript;
+    struct BhvDecodedCmd *cmd;
+    u32 count;
+
+    if ((cmd = bhv_decoded_cmd_at(&script, gCurBhvCommand)) == NULL) {
+        return BHV_PROC_CONTINUE;
+    }
+
+    for (;;) {
+        switch (cmd->op) {
+            case BHV_OP_BEGIN:
+                cmd++;
+                break;
+
+            case BHV_OP_DELAY:
+                if (obj->bhvDelayTimer < cmd->arg - 1) {
+                    obj->bhvDelayTimer++;
+                } else {
+                    obj->bhvDelayTimer = 0;
+                    cmd++;
+                }
+                goto stop;
+
+            case BHV_OP_CALL:
+                cur_obj_bhv_stack_push((uintptr_t) BHV_DECODED_ADDR(script, cmd + 2));
+                // fall through
+            case BHV_OP_GOTO:
+                if (cmd->value.target == NULL) {
+                    struct BhvDecodedScript *targetScript = NULL;
+                    struct BhvDecodedCmd *target;
+
+                    gCurBhvCommand = segmented_to_virtual((void *) BHV_DECODED_ADDR(script, cmd)[1]);
+                    if ((target = bhv_decoded_cmd_at(&targetScript, gCurBhvCommand)) == NULL) {
+                        obj->bhvDecodedScript = script;
+                        return BHV_PROC_CONTINUE;
+                    }
+                    cmd->value.target = target;
+                    cmd->targetScript = targetScript;
+                }
+                script = cmd->targetScript;
+                cmd = cmd->value.target;
+                break;
+
+            case BHV_OP_RETURN:
+                gCurBhvCommand = (const BehaviorScript *) cur_obj_bhv_stack_pop();
+                goto resume;
+
+            case BHV_OP_BEGIN_REPEAT:
+                cur_obj_bhv_stack_push((uintptr_t) BHV_DECODED_ADDR(script, cmd + 1));
+                cur_obj_bhv_stack_push(cmd->arg);
+                cmd++;
+                break;
+
+            case BHV_OP_END_REPEAT:
+            case BHV_OP_END_REPEAT_CONTINUE:
+                count = cur_obj_bhv_stack_pop();
+                count--;
+
+                if (count != 0) {
+                    gCurBhvCommand = (const BehaviorScript *) cur_obj_bhv_stack_pop();
+                    cur_obj_bhv_stack_push((uintptr_t) gCurBhvCommand);
+                    cur_obj_bhv_stack_push(count);
+
+                    if (cmd->op == BHV_OP_END_REPEAT) {
+                        obj->bhvDecodedScript = script;
+                        return BHV_PROC_BREAK;
+                    }
+                    goto resume;
+                }
+
+                cur_obj_bhv_stack_pop();
+                if (cmd->op == BHV_OP_END_REPEAT) {
+                    cmd++;
+                    goto stop;
+                }
+                cmd++;
+                break;
+
+            case BHV_OP_BEGIN_LOOP:
+                cur_obj_bhv_stack_push((uintptr_t) BHV_DECODED_ADDR(script, cmd + 1));
+                cmd++;
+                break;
+
+            case BHV_OP_END_LOOP:
+                gCurBhvCommand = (const BehaviorScript *) cur_obj_bhv_stack_pop();
+                cur_obj_bhv_stack_push((uintptr_t) gCurBhvCommand);
+                obj->bhvDecodedScript = script;
+                return BHV_PROC_BREAK;
+
+            case BHV_OP_BREAK:
+            case BHV_OP_BREAK_UNUSED:
+                goto stop;
+
+            case BHV_OP_DEACTIVATE:
+                obj->activeFlags = ACTIVE_FLAG_DEACTIVATED;
+                goto stop;
+
+            case BHV_OP_CALL_NATIVE:
+                cmd->value.asFunc();
+                cmd += 2;
+                break;
+
+            case BHV_OP_ADD_FLOAT:
+                cur_obj_add_float(cmd->field, cmd->value.asF32);
+                cmd++;
+                break;
+
+            case BHV_OP_SET_FLOAT:
+                cur_obj_set_float(cmd->field, cmd->value.asF32);
+                cmd++;
+                break;
+
+            case BHV_OP_ADD_INT:
+                cur_obj_add_int(cmd->field, cmd->arg);
+                cmd++;
+                break;
+
+            case BHV_OP_SET_INT:
+                cur_obj_set_int(cmd->field, cmd->arg);
+                if (cmd->field == O_INTERACT_TYPE_INDEX) {
+                    obj_update_time_stop_exemption(obj);
+                }
+                cmd++;
+                break;
+
+            case BHV_OP_OR_INT:
+                cur_obj_or_int(cmd->field, cmd->value.asS32);
+                cmd++;
+                break;
+
+            case BHV_OP_BIT_CLEAR:
+                cur_obj_and_int(cmd->field, cmd->value.asS32);
+                cmd++;
+                break;
+
+            case BHV_OP_SET_MODEL:
+                obj->header.gfx.sharedChild = gLoadedGraphNodes[cmd->arg];
+                cmd++;
+                break;
+
+            case BHV_OP_BILLBOARD:
+                obj->header.gfx.node.flags |= GRAPH_RENDER_BILLBOARD;
+                cmd++;
+                break;
+
+            case BHV_OP_HIDE:
+                cur_obj_hide();
+                cmd++;
+                break;
+
+            case BHV_OP_SET_HITBOX:
+                obj->hitboxRadius = cmd->arg;
+                obj->hitboxHeight = cmd->value.asS32;
+                cmd += 2;
+                break;
+
+            case BHV_OP_SET_HURTBOX:
+                obj->hurtboxRadius = cmd->arg;
+                obj->hurtboxHeight = cmd->value.asS32;
+                cmd += 2;
+                break;
+
+            case BHV_OP_LOAD_ANIMATIONS:
+                cur_obj_set_vptr(cmd->field, cmd->value.asVoidPtr);
+                cmd += 2;
+                break;
+
+            case BHV_OP_LOAD_COLLISION_DATA:
+                obj->collisionData = cmd->value.asVoidPtr;
+                cmd += 2;
+                break;
+
+            case BHV_OP_SET_HOME:
+                obj->oHomeX = obj->oPosX;
+                obj->oHomeY = obj->oPosY;
+                obj->oHomeZ = obj->oPosZ;
+                cmd++;
+                break;
+
+            case BHV_OP_SET_INTERACT_TYPE:
+                obj->oInteractType = cmd->value.asS32;
+                obj_update_time_stop_exemption(obj);
+                cmd += 2;
+                break;
+
+            case BHV_OP_SCALE:
+                cur_obj_scale(cmd->value.asF32);
+                cmd++;
+                break;
+
+            case BHV_OP_ANIMATE_TEXTURE:
+                if ((gGlobalTimer % cmd->arg) == 0) {
+                    cur_obj_add_int(cmd->field, 1);
+                }
+                cmd++;
+                break;
+
+            default:
+                // Rarely used command, run it through the table.
+                gCurBhvCommand = BHV_DECODED_ADDR(script, cmd);
+                if (BehaviorCmdTable[cmd->op]() == BHV_PROC_BREAK) {
+                    obj->bhvDecodedScript = script;
+                    return BHV_PROC_BREAK;
+                }
+                goto resume;
+        }
+        continue;
+
+    resume:
+        // Continue from the raw address in gCurBhvCommand.
+        if ((cmd = bhv_decoded_cmd_at(&script, gCurBhvCommand)) == NULL) {
+            obj->bhvDecodedScript = script;
+            return BHV_PROC_CONTINUE;
+        }
+    }
+
+stop:
+    gCurBhvCommand = BHV_DECODED_ADDR(script, cmd);
+    obj->bhvDecodedScript = script;
+    return BHV_PROC_BREAK;
+}
+#else
+void clear_bhv_decode_cache(void) {
+}
+#endif
+
 // Execute the behavior script of the current object, process the object flags, and other miscellaneous
 // code for updating objects.
 void cur_obj_update(void) {
@@ -933,10 +1409,16 @@ void cur_obj_update(void) {
     // Execute the behavior script.
     gCurBhvCommand = gCurrentObject->curBhvCommand;
 
-    do {
+#ifdef BHV_SCRIPT_PREDECODE
+    bhvProcResult = cur_obj_run_decoded_script();
+#else
+    bhvProcResult = BHV_PROC_CONTINUE;
+#endif
+
+    while (bhvProcResult == BHV_PROC_CONTINUE) {
         bhvCmdProc = BehaviorCmdTable[*gCurBhvCommand >> 24];
         bhvProcResult = bhvCmdProc();
-    } while (bhvProcResult == BHV_PROC_CONTINUE);
+    }
 
     gCurrentObject->curBhvCommand = gCurBhvCommand;
 
@@ -24,6 +24,7 @@ float random_float(void);
 s32 random_sign(void);
 
 void stub_behavior_script_2(void);
+void clear_bhv_decode_cache(void);
 
 void cur_obj_update(void);
 
@@ -793,5 +793,14 @@ struct GraphNode *process_geo_layout(struct AllocOnlyPool *pool, void *segptr) {
         GeoLayoutJumpTable[gGeoLayoutCommand[0x00]]();
     }
 
+#ifdef FRUSTUM_CULLING
+    geo_compute_culling_spheres(gCurRootGraphNode);
+#endif
+#ifdef FLATTEN_STATIC_GEO
+    if (pool != NULL) {
+        geo_flatten_static_subtrees(pool, gCurRootGraphNode);
+    }
+#endif
+
     return gCurRootGraphNode;
 }
@@ -400,6 +400,11 @@ struct GraphNodeDisplayList *init_graph_node_display_list(struct AllocOnlyPool *
         init_scene_graph_node_links(&graphNode->node, GRAPH_NODE_TYPE_DISPLAY_LIST);
         graphNode->node.flags = (drawingLayer << 8) | (graphNode->node.flags & 0xFF);
         graphNode->displayList = displayList;
+#ifdef FRUSTUM_CULLING
+        vec3s_set(graphNode->cullCenter, 0, 0, 0);
+        graphNode->cullRadius = 0;
+        graphNode->cullSubtree = FALSE;
+#endif
     }
 
     return graphNode;
@@ -885,3 +890,452 @@ struct GraphNodeRoot *geo_find_root(struct GraphNode *graphNode) {
 
     return resGraphNode;
 }
+
+#ifdef FRUSTUM_CULLING
+// How deep to follow nested display lists when bounding a display list
+#define CULLING_DL_MAX_DEPTH 4
+// How many commands to read from one display list before giving up on it
+#define CULLING_DL_MAX_LENGTH 0x2000
+
+static Vec3f sCullBoundsMin;
+static Vec3f sCullBoundsMax;
+static Vec3f sCullBoundsCenter;
+static f32 sCullBoundsRadiusSq;
+static s32 sCullBoundsNumVertices;
+
+/**
+ * Grow the bounding box being built by the vertices of a display list.
+ */
+static void add_vertex_to_cull_box(Vtx *vtx) {
+    s32 i;
+
+    for (i = 0; i < 3; i++) {
+        if (sCullBoundsNumVertices == 0 || vtx->v.ob[i] < sCullBoundsMin[i]) {
+            sCullBoundsMin[i] = vtx->v.ob[i];
+        }
+        if (sCullBoundsNumVertices == 0 || vtx->v.ob[i] > sCullBoundsMax[i]) {
+            sCullBoundsMax[i] = vtx->v.ob[i];
+        }
+    }
+
+    sCullBoundsNumVertices++;
+}
+
+/**
+ * Grow the radius of the bounding sphere being built, around the center of
+ * the bounding box, to include a vertex.
+ */
+static void add_vertex_to_cull_sphere(Vtx *vtx) {
+    f32 dx = vtx->v.ob[0] - sCullBoundsCenter[0];
+    f32 dy = vtx->v.ob[1] - sCullBoundsCenter[1];
+    f32 dz = vtx->v.ob[2] - sCullBoundsCenter[2];
+    f32 distSq = dx * dx + dy * dy + dz * dz;
+
+    if (distSq > sCullBoundsRadiusSq) {
+        sCullBoundsRadiusSq = distSq;
+    }
+}
+
+/**
+ * Call func on every vertex loaded by a display list, including the ones in
+ * the display lists it calls. Return FALSE if the display list couldn't be
+ * read to the end, in which case its bounds are unknown.
+ */
+static s32 for_each_display_list_vertex(Gfx *dl, s32 depth, void (*func)(Vtx *)) {
+    Vtx *vtx;
+    s32 numVertices;
+    s32 i;
+    s32 j;
+
+    if (depth >= CULLING_DL_MAX_DEPTH) {
+        return FALSE;
+    }
+
+    dl = segmented_to_virtual(dl);
+
+    for (i = 0; i < CULLING_DL_MAX_LENGTH; i++, dl++) {
+        switch ((u8) (dl->words.w0 >> 24)) {
+            case G_VTX:
+                // Fast3D: the low 16 bits are the size of the vertex data
+                vtx = segmented_to_virtual((void *) (uintptr_t) dl->words.w1);
+                numVertices = (dl->words.w0 & 0xFFFF) / sizeof(Vtx);
+                for (j = 0; j < numVertices; j++) {
+                    func(&vtx[j]);
+                }
+                break;
+
+            case G_DL:
+                if (!for_each_display_list_vertex((Gfx *) (uintptr_t) dl->words.w1, depth + 1, func)) {
+                    return FALSE;
+                }
+                if (((dl->words.w0 >> 16) & 0xFF) == G_DL_NOPUSH) {
+                    return TRUE;
+                }
+                break;
+
+            case (u8) G_ENDDL:
+                return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * Compute a sphere bounding the vertices of a display list node. The radius is
+ * left at 0 if the display list can't be bounded, which means it is never
+ * culled.
+ */
+static void geo_compute_display_list_sphere(struct GraphNodeDisplayList *node) {
+    f32 radius;
+    s32 i;
+
+    sCullBoundsNumVertices = 0;
+    sCullBoundsRadiusSq = 0.0f;
+
+    if (node->displayList == NULL
+        || !for_each_display_list_vertex(node->displayList, 0, add_vertex_to_cull_box)
+        || sCullBoundsNumVertices == 0) {
+        return;
+    }
+
+    // Measure the radius from the center as it will be stored
+    for (i = 0; i < 3; i++) {
+        node->cullCenter[i] = (sCullBoundsMin[i] + sCullBoundsMax[i]) / 2.0f;
+        sCullBoundsCenter[i] = node->cullCenter[i];
+    }
+
+    for_each_display_list_vertex(node->displayList, 0, add_vertex_to_cull_sphere);
+
+    // Round up, and leave spheres too large for the field unbounded
+    radius = sqrtf(sCullBoundsRadiusSq) + 1.0f;
+    node->cullRadius = (radius <= 0x7FFF) ? radius : 0;
+}
+
+/**
+ * Grow a display list node's sphere to bound its children's spheres. All of
+ * the children must be display list nodes with a subtree sphere, since those
+ * are drawn in the same space as their parent.
+ */
+static s32 geo_compute_subtree_sphere(struct GraphNodeDisplayList *node) {
+    struct GraphNode *firstChild = node->node.children;
+    struct GraphNode *child = firstChild;
+    struct GraphNodeDisplayList *dlNode;
+    Vec3f center;
+    f32 radius;
+    f32 dx;
+    f32 dy;
+    f32 dz;
+    s32 i;
+
+    if (node->cullRadius == 0) {
+        return FALSE;
+    }
+
+    if (child == NULL) {
+        return TRUE;
+    }
+
+    // Find the box around every sphere in the subtree
+    for (i = 0; i < 3; i++) {
+        sCullBoundsMin[i] = node->cullCenter[i] - node->cullRadius;
+        sCullBoundsMax[i] = node->cullCenter[i] + node->cullRadius;
+    }
+    do {
+        dlNode = (struct GraphNodeDisplayList *) child;
+        if (child->type != GRAPH_NODE_TYPE_DISPLAY_LIST || !dlNode->cullSubtree) {
+            return FALSE;
+        }
+        for (i = 0; i < 3; i++) {
+            sCullBoundsMin[i] = min(sCullBoundsMin[i], dlNode->cullCenter[i] - dlNode->cullRadius);
+            sCullBoundsMax[i] = max(sCullBoundsMax[i], dlNode->cullCenter[i] + dlNode->cullRadius);
+        }
+    } while ((child = child->next) != firstChild);
+
+    // Bound every sphere from the center of that box
+    for (i = 0; i < 3; i++) {
+        center[i] = (s16) ((sCullBoundsMin[i] + sCullBoundsMax[i]) / 2.0f);
+    }
+    dx = node->cullCenter[0] - center[0];
+    dy = node->cullCenter[1] - center[1];
+    dz = node->cullCenter[2] - center[2];
+    radius = sqrtf(dx * dx + dy * dy + dz * dz) + node->cullRadius;
+    do {
+        dlNode = (struct GraphNodeDisplayList *) child;
+        dx = dlNode->cullCenter[0] - center[0];
+        dy = dlNode->cullCenter[1] - center[1];
+        dz = dlNode->cullCenter[2] - center[2];
+        radius = max(radius, sqrtf(dx * dx + dy * dy + dz * dz) + dlNode->cullRadius);
+    } while ((child = child->next) != firstChild);
+
+    if (radius + 1.0f > 0x7FFF) {
+        return FALSE;
+    }
+
+    vec3f_to_vec3s(node->cullCenter, center);
+    node->cullRadius = radius + 1.0f;
+    return TRUE;
+}
+
+/**
+ * Compute the culling spheres of every display list node in a graph node tree
+ * that was just built from a geo layout, children first, so that a display
+ * list node whose children are all bounded display list nodes gets a sphere
+ * around its whole subtree.
+ */
+void geo_compute_culling_spheres(struct GraphNode *firstNode) {
+    struct GraphNode *curNode = firstNode;
+
+    if (firstNode == NULL) {
+        return;
+    }
+
+    do {
+        if (curNode->children != NULL) {
+            geo_compute_culling_spheres(curNode->children);
+        }
+
+        if (curNode->type == GRAPH_NODE_TYPE_DISPLAY_LIST) {
+            struct GraphNodeDisplayList *dlNode = (struct GraphNodeDisplayList *) curNode;
+
+            geo_compute_display_list_sphere(dlNode);
+            dlNode->cullSubtree = geo_compute_subtree_sphere(dlNode);
+        }
+    } while ((curNode = curNode->next) != firstNode);
+}
+#endif
+
+#ifdef FLATTEN_STATIC_GEO
+static Mat4 *sFlatMatrices;
+static struct FlattenedDisplayList *sFlatDisplayLists;
+static s32 sNumFlatMatrices;
+static s32 sNumFlatDisplayLists;
+
+/**
+ * Return whether a node and all of its descendants can be flattened, and count
+ * the transforms and display lists the flattened form would need.
+ */
+static s32 geo_is_static_subtree(struct GraphNode *node) {
+    struct GraphNode *child;
+
+    if (!(node->flags & GRAPH_RENDER_ACTIVE)) {
+        return FALSE;
+    }
+
+    switch (node->type) {
+        case GRAPH_NODE_TYPE_TRANSLATION_ROTATION:
+        case GRAPH_NODE_TYPE_TRANSLATION:
+        case GRAPH_NODE_TYPE_ROTATION:
+        case GRAPH_NODE_TYPE_SCALE:
+            if (!(node->flags & GRAPH_RENDER_CHILDREN_FIRST)) {
+                sNumFlatMatrices++;
+                sNumFlatDisplayLists++;
+            }
+            break;
+
+        case GRAPH_NODE_TYPE_DISPLAY_LIST:
+            if (!(node->flags & GRAPH_RENDER_CHILDREN_FIRST)) {
+                sNumFlatDisplayLists++;
+            }
+            break;
+
+        case GRAPH_NODE_TYPE_START:
+        case GRAPH_NODE_TYPE_CULLING_RADIUS:
+            break;
+
+        default:
+            return FALSE;
+    }
+
+    if ((child = node->children) != NULL) {
+        do {
+            if (!geo_is_static_subtree(child)) {
+                return FALSE;
+            }
+        } while ((child = child->next) != node->children);
+    }
+
+    return TRUE;
+}
+
+/**
+ * Add a display list to the flattened subtree being built.
+ */
+static void geo_add_flat_display_list(void *displayList, struct GraphNodeDisplayList *cullNode,
+                                      s32 matrixIndex, s32 layer) {
+    struct FlattenedDisplayList *flatList;
+
+    if (displayList != NULL) {
+        flatList = &sFlatDisplayLists[sNumFlatDisplayLists++];
+        flatList->displayList = displayList;
+        flatList->cullNode = cullNode;
+        flatList->matrixIndex = matrixIndex;
+        flatList->layer = layer;
+    }
+}
+
+/**
+ * Add a node and its descendants to the flattened subtree being built, in the
+ * same order geo_process_node_and_siblings would draw them. mtx is the
+ * transform of the node's parent relative to the flattened node's parent, at
+ * index matrixIndex in the matrix array, or -1 if there is none yet.
+ */
+static void geo_flatten_node(struct GraphNode *node, s32 matrixIndex) {
+    struct GraphNode *child;
+    Mat4 mtxf;
+    Mat4 *parentMtx;
+    Vec3f translation;
+    Vec3f scaleVec;
+    void *displayList = NULL;
+    s32 layer = node->flags >> 8;
+
+    if (!(node->flags & GRAPH_RENDER_CHILDREN_FIRST)) {
+        parentMtx = (matrixIndex >= 0) ? &sFlatMatrices[matrixIndex] : NULL;
+
+        switch (node->type) {
+            case GRAPH_NODE_TYPE_TRANSLATION_ROTATION:
+                vec3s_to_vec3f(translation, ((struct GraphNodeTranslationRotation *) node)->translation);
+                mtxf_rotate_zxy_and_translate(mtxf, translation,
+                                              ((struct GraphNodeTranslationRotation *) node)->rotation);
+                displayList = ((struct GraphNodeTranslationRotation *) node)->displayList;
+                break;
+
+            case GRAPH_NODE_TYPE_TRANSLATION:
+                vec3s_to_vec3f(translation, ((struct GraphNodeTranslation *) node)->translation);
+                mtxf_rotate_zxy_and_translate(mtxf, translation, gVec3sZero);
+                displayList = ((struct GraphNodeTranslation *) node)->displayList;
+                break;
+
+            case GRAPH_NODE_TYPE_ROTATION:
+                mtxf_rotate_zxy_and_translate(mtxf, gVec3fZero, ((struct GraphNodeRotation *) node)->rotation);
+                displayList = ((struct GraphNodeRotation *) node)->displayList;
+                break;
+
+            case GRAPH_NODE_TYPE_SCALE:
+                vec3f_set(scaleVec, ((struct GraphNodeScale *) node)->scale,
+                          ((struct GraphNodeScale *) node)->scale, ((struct GraphNodeScale *) node)->scale);
+                mtxf_identity(mtxf);
+                mtxf_scale_vec3f(mtxf, mtxf, scaleVec);
+                displayList = ((struct GraphNodeScale *) node)->displayList;
+                break;
+
+            case GRAPH_NODE_TYPE_DISPLAY_LIST:
+                geo_add_flat_display_list(((struct GraphNodeDisplayList *) node)->displayList,
+                                          (struct GraphNodeDisplayList *) node, matrixIndex, layer);
+                break;
+        }
+
+        // Transform nodes multiply their matrix onto their parent's, exactly
+        // as when they are rendered
+        switch (node->type) {
+            case GRAPH_NODE_TYPE_TRANSLATION_ROTATION:
+            case GRAPH_NODE_TYPE_TRANSLATION:
+            case GRAPH_NODE_TYPE_ROTATION:
+            case GRAPH_NODE_TYPE_SCALE:
+                if (parentMtx != NULL) {
+                    mtxf_mul(sFlatMatrices[sNumFlatMatrices], mtxf, *parentMtx);
+                } else {
+                    mtxf_copy(sFlatMatrices[sNumFlatMatrices], mtxf);
+                }
+                matrixIndex = sNumFlatMatrices++;
+                geo_add_flat_display_list(displayList, NULL, matrixIndex, layer);
+                break;
+        }
+    }
+
+    if ((child = node->children) != NULL) {
+        do {
+            geo_flatten_node(child, matrixIndex);
+        } while ((child = child->next) != node->children);
+    }
+}
+
+/**
+ * Replace a static subtree with a flattened node that draws the same display
+ * lists with the same transforms. Return the node now in the subtree's place,
+ * which is the subtree itself if the pool is out of space.
+ */
+static struct GraphNode *geo_flatten_subtree(struct AllocOnlyPool *pool, struct GraphNode *node) {
+    struct GraphNodeFlattened *flatNode = alloc_only_pool_alloc(pool, sizeof(struct GraphNodeFlattened));
+    Mat4 *matrices = alloc_only_pool_alloc(pool, sNumFlatMatrices * sizeof(Mat4));
+    struct FlattenedDisplayList *displayLists =
+        alloc_only_pool_alloc(pool, sNumFlatDisplayLists * sizeof(struct FlattenedDisplayList));
+
+    if (flatNode == NULL || matrices == NULL || displayLists == NULL) {
+        return node;
+    }
+
+    init_scene_graph_node_links(&flatNode->node, GRAPH_NODE_TYPE_FLATTENED);
+    flatNode->matrices = matrices;
+    flatNode->displayLists = displayLists;
+
+    sFlatMatrices = flatNode->matrices;
+    sFlatDisplayLists = flatNode->displayLists;
+    sNumFlatMatrices = 0;
+    sNumFlatDisplayLists = 0;
+    geo_flatten_node(node, -1);
+    flatNode->numMatrices = sNumFlatMatrices;
+    flatNode->numDisplayLists = sNumFlatDisplayLists;
+
+    // Take the subtree's place among its siblings
+    if (node->next == node) {
+        flatNode->node.prev = &flatNode->node;
+        flatNode->node.next = &flatNode->node;
+    } else {
+        flatNode->node.prev = node->prev;
+        flatNode->node.next = node->next;
+        node->prev->next = &flatNode->node;
+        node->next->prev = &flatNode->node;
+    }
+    flatNode->node.parent = node->parent;
+    if (node->parent->children == node) {
+        node->parent->children = &flatNode->node;
+    }
+
+    // Keep the subtree as the flattened node's only child
+    node->prev = node;
+    node->next = node;
+    node->parent = &flatNode->node;
+    flatNode->node.children = node;
+
+    return &flatNode->node;
+}
+
+/**
+ * Flatten every static subtree among a list of siblings and their descendants
+ * that has at least one transform. Subtree roots without a parent are left
+ * alone, since they are referenced directly (for example as an object's
+ * model). So are subtrees that follow a functional node: callbacks like
+ * geo_mario_head_rotation change the node after theirs through node->next.
+ */
+void geo_flatten_static_subtrees(struct AllocOnlyPool *pool, struct GraphNode *firstNode) {
+    struct GraphNode *curNode = firstNode;
+    struct GraphNode *nextNode;
+    struct GraphNode *flatNode;
+
+    if (firstNode == NULL) {
+        return;
+    }
+
+    do {
+        nextNode = curNode->next;
+
+        sNumFlatMatrices = 0;
+        sNumFlatDisplayLists = 0;
+        if (curNode->parent != NULL && !(curNode->prev->type & GRAPH_NODE_TYPE_FUNCTIONAL)
+            && geo_is_static_subtree(curNode) && sNumFlatMatrices > 0
+            && sNumFlatMatrices <= 0x7FFF && sNumFlatDisplayLists <= 0x7FFF) {
+            // The flattened node takes curNode's place in the sibling list
+            flatNode = geo_flatten_subtree(pool, curNode);
+            if (nextNode == curNode) {
+                nextNode = flatNode;
+            }
+            if (firstNode == curNode) {
+                firstNode = flatNode;
+            }
+        } else if (curNode->children != NULL) {
+            geo_flatten_static_subtrees(pool, curNode->children);
+        }
+    } while ((curNode = nextNode) != firstNode);
+}
+#endif
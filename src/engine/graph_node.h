@@ -43,6 +43,7 @@
 #define GRAPH_NODE_TYPE_BACKGROUND           (0x02C | GRAPH_NODE_TYPE_FUNCTIONAL)
 #define GRAPH_NODE_TYPE_HELD_OBJ             (0x02E | GRAPH_NODE_TYPE_FUNCTIONAL)
 #define GRAPH_NODE_TYPE_CULLING_RADIUS        0x02F
+#define GRAPH_NODE_TYPE_FLATTENED             0x030
 
 // The number of master lists. A master list determines the order and render
 // mode with which display lists are drawn.
@@ -114,6 +115,12 @@ struct DisplayListNode {
     Mtx *transform;
     void *displayList;
     struct DisplayListNode *next;
+#ifdef MASTER_LIST_SORTING
+    u32 textureKey; // first texture image the display list loads
+    u32 combineKey; // first color combiner the display list sets
+    u8 stateOnly;   // the display list only sets state for the ones after it
+    u8 pinned;      // the display list must keep its place when the layer is sorted
+#endif
 };
 
 /** GraphNode that manages the 8 top-level display lists that will be drawn
@@ -245,6 +252,11 @@ struct GraphNodeBillboard {
 struct GraphNodeDisplayList {
     /*0x00*/ struct GraphNode node;
     /*0x14*/ void *displayList;
+#ifdef FRUSTUM_CULLING
+    /*0x18*/ Vec3s cullCenter; // center of a sphere bounding the display list's vertices
+    /*0x1E*/ s16 cullRadius;   // 0 if the display list has no bounds and is never culled
+    /*0x20*/ s16 cullSubtree;  // whether the sphere also bounds every child
+#endif
 };
 
 /** GraphNode part that scales itself and its children.
@@ -261,6 +273,33 @@ struct GraphNodeScale {
     /*0x18*/ f32 scale;
 };
 
+#ifdef FLATTEN_STATIC_GEO
+/** A display list drawn by a flattened subtree.
+ */
+struct FlattenedDisplayList {
+    /*0x00*/ void *displayList;
+    /*0x04*/ struct GraphNodeDisplayList *cullNode; // node with the culling sphere, if any
+    /*0x08*/ s16 matrixIndex; // -1 to draw with the flattened node's own transform
+    /*0x0A*/ s16 layer;
+};
+
+/** GraphNode that stands in for a subtree containing only display list,
+ *  translation, rotation and scale nodes. The subtree's transforms are
+ *  multiplied together once when the geo layout is loaded, so rendering it is
+ *  a linear walk over its display lists, with one matrix multiplication for
+ *  each distinct transform. The original subtree is kept as the only child so
+ *  that code looking for nodes in the graph still finds them, but it is not
+ *  processed when rendering.
+ */
+struct GraphNodeFlattened {
+    /*0x00*/ struct GraphNode node;
+    /*0x14*/ Mat4 *matrices; // relative to the flattened node's parent
+    /*0x18*/ struct FlattenedDisplayList *displayLists;
+    /*0x1C*/ s16 numMatrices;
+    /*0x1E*/ s16 numDisplayLists;
+};
+#endif
+
 /** GraphNode that draws a shadow under an object.
  *  Every object starts with a shadow node.
  *  The shadow type determines the shape (round or rectangular), vertices (4 or 9)
@@ -407,5 +446,7 @@ s16 *read_vec3s_to_vec3f(Vec3f, s16 *src);
 s16 *read_vec3s(Vec3s dst, s16 *src);
 s16 *read_vec3s_angle(Vec3s dst, s16 *src);
 void register_scene_graph_node(struct GraphNode *graphNode);
+void geo_compute_culling_spheres(struct GraphNode *firstNode);
+void geo_flatten_static_subtrees(struct AllocOnlyPool *pool, struct GraphNode *firstNode);
 
 #endif // GRAPH_NODE_H
@@ -9,12 +9,19 @@
 #include "buffers/zbuffer.h"
 #include "game/area.h"
 #include "game/game_init.h"
+#include "game/ingame_menu.h"
 #include "game/mario.h"
 #include "game/memory.h"
+#include "game/moving_texture.h"
 #include "game/object_helpers.h"
 #include "game/object_list_processor.h"
+#include "game/paintings.h"
+#include "game/particle_system.h"
 #include "game/profiler.h"
+#include "game/rendering_graph_node.h"
 #include "game/save_file.h"
+#include "game/shadow.h"
+#include "game/skybox.h"
 #include "game/sound_init.h"
 #include "goddard/renderer.h"
 #include "geo_layout.h"
@@ -304,6 +311,22 @@ static void level_cmd_init_level(void) {
     clear_objects();
     clear_areas();
     main_pool_push_state();
+    alloc_particles();
+#ifdef MTX_CACHE
+    alloc_mtx_cache();
+#endif
+#ifdef SHADOW_CACHE
+    alloc_shadow_cache();
+#endif
+#ifdef SKYBOX_STATIC_TILES
+    alloc_skybox_tile_verts();
+#endif
+#ifdef PAINTING_INCREMENTAL_RIPPLE
+    alloc_painting_ripple_meshes();
+#endif
+#ifdef MOVTEX_RESIDENT_VTX
+    alloc_movtex_buffers();
+#endif
 
     sCurrentCmd = CMD_NEXT;
 }
@@ -312,6 +335,25 @@ static void level_cmd_clear_level(void) {
     clear_objects();
     clear_area_graph_nodes();
     clear_areas();
+    free_particles();
+#ifdef MTX_CACHE
+    free_mtx_cache();
+#endif
+#ifdef SHADOW_CACHE
+    free_shadow_cache();
+#endif
+#ifdef SKYBOX_STATIC_TILES
+    free_skybox_tile_verts();
+#endif
+#ifdef PAINTING_INCREMENTAL_RIPPLE
+    free_painting_ripple_meshes();
+#endif
+#ifdef MOVTEX_RESIDENT_VTX
+    free_movtex_buffers();
+#endif
+#ifdef DIALOG_PAGE_CACHE
+    reset_dialog_page_cache();
+#endif
     main_pool_pop_state();
 
     sCurrentCmd = CMD_NEXT;
@@ -592,6 +592,38 @@ void mtxf_to_mtx(Mtx *dest, Mat4 src) {
 #endif
 }
 
+/**
+ * Convert the float matrix 'src' of a billboard to fixed point matrix 'dest'.
+ * 'src' must be built by mtxf_billboard, optionally followed by
+ * mtxf_scale_vec3f: its fourth column is then (0, 0, 0, 1), and [0][2],
+ * [1][2], [2][0] and [2][1] are zero, so only the 8 roll, scale and
+ * translation entries need the float-to-fixed conversion.
+ */
+void mtxf_billboard_to_mtx(Mtx *dest, Mat4 src) {
+#ifdef AVOID_UB
+    // Same as mtxf_to_mtx, the generic conversion avoids the type-punning
+    guMtxF2L(src, dest);
+#else
+    static const u8 entries[] = { 0, 1, 4, 5, 10, 12, 13, 14 };
+    s32 asFixedPoint;
+    register s32 i;
+    register s16 *a3 = (s16 *) dest;      // all integer parts stored in first 16 bytes
+    register s16 *t0 = (s16 *) dest + 16; // all fraction parts stored in last 16 bytes
+    register f32 *t1 = (f32 *) src;
+    register s32 *words = (s32 *) dest;
+
+    for (i = 0; i < 16; i++) {
+        words[i] = 0;
+    }
+    for (i = 0; i < ARRAY_COUNT(entries); i++) {
+        asFixedPoint = t1[entries[i]] * (1 << 16);
+        a3[entries[i]] = GET_HIGH_S16_OF_32(asFixedPoint);
+        t0[entries[i]] = GET_LOW_S16_OF_32(asFixedPoint);
+    }
+    a3[15] = 1;
+#endif
+}
+
 /**
  * Set 'mtx' to a transformation matrix that rotates around the z axis.
  */
@@ -22,6 +22,19 @@ s32 unused8038BE90;
 SpatialPartitionCell gStaticSurfacePartition[NUM_CELLS][NUM_CELLS];
 SpatialPartitionCell gDynamicSurfacePartition[NUM_CELLS][NUM_CELLS];
 
+#ifdef SHADOW_CACHE
+/**
+ * Incremented every time the static surfaces are reloaded.
+ */
+static u32 sStaticSurfaceVersion;
+
+/**
+ * A hash of the dynamic surfaces in each cell, rebuilt along with the dynamic
+ * partition. It stays the same for as long as the surfaces in the cell don't move.
+ */
+static u32 sDynamicSurfaceCellHash[NUM_CELLS][NUM_CELLS];
+#endif
+
 /**
  * Pools of data to contain either surface nodes or surfaces.
  */
@@ -250,6 +263,23 @@ static s16 upper_cell_index(TerrainData coord) {
     return index;
 }
 
+#ifdef SHADOW_CACHE
+/**
+ * Hash the vertices and type of a surface.
+ */
+static u32 hash_surface(struct Surface *surface) {
+    u32 hash = 2166136261U;
+    s32 i;
+
+    for (i = 0; i < 3; i++) {
+        hash = (hash ^ (u16) surface->vertex1[i]) * 16777619U;
+        hash = (hash ^ (u16) surface->vertex2[i]) * 16777619U;
+        hash = (hash ^ (u16) surface->vertex3[i]) * 16777619U;
+    }
+    return (hash ^ (u16) surface->type) * 16777619U;
+}
+#endif
+
 /**
  * Every level is split into 16x16 cells, this takes a surface, finds
  * the appropriate cells (with a buffer), and adds the surface to those
@@ -283,6 +313,20 @@ static void add_surface(struct Surface *surface, s32 dynamic) {
             add_surface_to_cell(dynamic, cellX, cellZ, surface);
         }
     }
+
+#ifdef SHADOW_CACHE
+    if (dynamic) {
+        u32 hash = hash_surface(surface);
+
+        // Added rather than chained, so that the hash doesn't depend on the order
+        // in which objects load their surfaces
+        for (cellZ = minCellZ; cellZ <= maxCellZ; cellZ++) {
+            for (cellX = minCellX; cellX <= maxCellX; cellX++) {
+                sDynamicSurfaceCellHash[cellZ][cellX] += hash;
+            }
+        }
+    }
+#endif
 }
 
 UNUSED static void stub_surface_load_1(void) {
@@ -591,6 +635,9 @@ void load_area_terrain(s16 index, TerrainData *data, RoomData *surfaceRooms, s16
     gSurfacesAllocated = 0;
 
     clear_static_surfaces();
+#ifdef SHADOW_CACHE
+    sStaticSurfaceVersion++;
+#endif
 
     // A while loop iterating through each section of the level data. Sections of data
     // are prefixed by a terrain "type." This type is reused for surfaces as the surface
@@ -643,9 +690,36 @@ void clear_dynamic_surfaces(void) {
         gSurfaceNodesAllocated = gNumStaticSurfaceNodes;
 
         clear_spatial_partition(&gDynamicSurfacePartition[0][0]);
+#ifdef SHADOW_CACHE
+        bzero(sDynamicSurfaceCellHash, sizeof(sDynamicSurfaceCellHash));
+#endif
     }
 }
 
+#ifdef SHADOW_CACHE
+/**
+ * Return a version of the surfaces within 'radius' of (x, z). It changes whenever
+ * the static surfaces are reloaded or a dynamic surface in one of the cells around
+ * the point moves, appears or disappears, so anything computed from the floors in
+ * that area can be kept for as long as the version stays the same.
+ */
+u32 get_surface_version(f32 x, f32 z, f32 radius) {
+    s16 minCellX = lower_cell_index(x - radius);
+    s16 maxCellX = upper_cell_index(x + radius);
+    s16 minCellZ = lower_cell_index(z - radius);
+    s16 maxCellZ = upper_cell_index(z + radius);
+    s16 cellX, cellZ;
+    u32 version = sStaticSurfaceVersion;
+
+    for (cellZ = minCellZ; cellZ <= maxCellZ; cellZ++) {
+        for (cellX = minCellX; cellX <= maxCellX; cellX++) {
+            version = (version ^ sDynamicSurfaceCellHash[cellZ][cellX]) * 16777619U;
+        }
+    }
+    return version;
+}
+#endif
+
 UNUSED static void unused_80383604(void) {
 }
 
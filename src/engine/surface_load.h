@@ -37,6 +37,9 @@ u32 get_area_terrain_size(TerrainData *data);
 #endif
 void load_area_terrain(s16 index, TerrainData *data, RoomData *surfaceRooms, s16 *macroObjects);
 void clear_dynamic_surfaces(void);
+#ifdef SHADOW_CACHE
+u32 get_surface_version(f32 x, f32 z, f32 radius);
+#endif
 void load_object_collision_model(void);
 
 #endif // SURFACE_LOAD_H
@@ -33,6 +33,7 @@
 #include "object_helpers.h"
 #include "object_list_processor.h"
 #include "paintings.h"
+#include "particle_system.h"
 #include "platform_displacement.h"
 #include "rendering_graph_node.h"
 #include "save_file.h"
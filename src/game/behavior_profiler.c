@@ -0,0 +1,227 @@
+#include <ultra64.h>
+#include <PR/R4300.h>
+#include <stddef.h>
+
+#include "sm64.h"
+#include "behavior_profiler.h"
+#include "engine/behavior_script.h"
+#include "game_init.h"
+#include "object_list_processor.h"
+#include "print.h"
+
+/**
+ * @file behavior_profiler.c
+ * Times every cur_obj_update call and aggregates the results per behavior
+ * script, to find the behaviors that take the most CPU time in a level.
+ *
+ * During a frame, calls are accumulated in a small hash table keyed by
+ * behavior. At the end of update_objects, the table is sorted into
+ * gBehaviorProfile, which is printed on screen and can be read by the host.
+ *
+ * The profiler is toggled with L on controller 3, and R cycles the sort key.
+ */
+
+// Must be a power of two, and larger than BHV_PROFILER_MAX_ENTRIES.
+#define BHV_PROFILER_TABLE_SIZE 128
+
+// Number of rows printed on screen, below the sort key row.
+#define BHV_PROFILER_PRINT_ROWS 4
+
+// osGetTime counts at 46.875 MHz.
+#define CYCLES_TO_USEC(cycles) (s32) ((u64) (cycles) * 64 / 3000)
+
+// Uncached alias of a field that the host may write.
+#define HOST_FIELD(field) (*(vu8 *) K0_TO_K1(&(field)))
+
+ALIGNED16 struct BehaviorProfile gBehaviorProfile = {
+    BHV_PROFILER_MAGIC, FALSE, BHV_PROFILE_SORT_CYCLES, { 0 }, 0, 0, 0, 0, 0, { { NULL, 0, 0, 0 } }
+};
+
+/**
+ * The enabled flag and sort key of gBehaviorProfile, read once per frame.
+ */
+s32 gBehaviorProfilerEnabled = FALSE;
+static s32 sBhvProfileSortKey = BHV_PROFILE_SORT_CYCLES;
+
+static struct BehaviorProfileEntry sBhvProfileTable[BHV_PROFILER_TABLE_SIZE];
+static s32 sBhvProfileNumEntries;
+static u32 sBhvProfileTotalCycles;
+static u32 sBhvProfileTotalCalls;
+
+/**
+ * Add one timed update to the entry for the given behavior.
+ */
+static void record_behavior_time(const BehaviorScript *behavior, u32 cycles) {
+    s32 i = ((uintptr_t) behavior >> 2) & (BHV_PROFILER_TABLE_SIZE - 1);
+    struct BehaviorProfileEntry *entry;
+
+    sBhvProfileTotalCycles += cycles;
+    sBhvProfileTotalCalls++;
+
+    // Linear probing
+    while ((entry = &sBhvProfileTable[i])->behavior != behavior) {
+        if (entry->behavior == NULL) {
+            if (sBhvProfileNumEntries >= BHV_PROFILER_MAX_ENTRIES) {
+                return;
+            }
+            sBhvProfileNumEntries++;
+            entry->behavior = behavior;
+            break;
+        }
+        i = (i + 1) & (BHV_PROFILER_TABLE_SIZE - 1);
+    }
+
+    entry->calls++;
+    entry->cycles += cycles;
+    if (entry->peakCycles < cycles) {
+        entry->peakCycles = cycles;
+    }
+}
+
+/**
+ * Update the current object, timing the update.
+ */
+void profile_cur_obj_update(void) {
+    // Read the behavior first, since the update may change it.
+    const BehaviorScript *behavior = gCurrentObject->behavior;
+    OSTime start = osGetTime();
+
+    cur_obj_update();
+
+    record_behavior_time(behavior, (u32) (osGetTime() - start));
+}
+
+/**
+ * Return the value of the given entry that the profile is sorted by.
+ */
+static u32 get_profile_sort_value(struct BehaviorProfileEntry *entry, s32 sortKey) {
+    switch (sortKey) {
+        case BHV_PROFILE_SORT_PEAK:
+            return entry->peakCycles;
+        case BHV_PROFILE_SORT_CALLS:
+            return entry->calls;
+        default:
+            return entry->cycles;
+    }
+}
+
+/**
+ * Publish the entries gathered this frame into gBehaviorProfile, sorted in
+ * descending order, and reset the table for the next frame.
+ */
+static void publish_behavior_profile(void) {
+    struct BehaviorProfileEntry *entries = gBehaviorProfile.entries;
+    struct BehaviorProfileEntry entry;
+    s32 sortKey = sBhvProfileSortKey;
+    s32 count = 0;
+    s32 i;
+    s32 j;
+
+    for (i = 0; i < BHV_PROFILER_TABLE_SIZE; i++) {
+        if (sBhvProfileTable[i].behavior != NULL) {
+            // Insertion sort, the table is small
+            entry = sBhvProfileTable[i];
+            for (j = count; j > 0 && get_profile_sort_value(&entries[j - 1], sortKey)
+                                         < get_profile_sort_value(&entry, sortKey);
+                 j--) {
+                entries[j] = entries[j - 1];
+            }
+            entries[j] = entry;
+            count++;
+
+            sBhvProfileTable[i].behavior = NULL;
+            sBhvProfileTable[i].calls = 0;
+            sBhvProfileTable[i].cycles = 0;
+            sBhvProfileTable[i].peakCycles = 0;
+        }
+    }
+
+    gBehaviorProfile.numEntries = count;
+    gBehaviorProfile.frame = gGlobalTimer;
+    gBehaviorProfile.totalCycles = sBhvProfileTotalCycles;
+    gBehaviorProfile.totalCalls = sBhvProfileTotalCalls;
+
+    sBhvProfileNumEntries = 0;
+    sBhvProfileTotalCycles = 0;
+    sBhvProfileTotalCalls = 0;
+
+    // Make the profile visible to a host reading RDRAM. The first cache line,
+    // which holds the host-owned fields, is left out.
+    osWritebackDCache(&gBehaviorProfile.numEntries,
+                      sizeof(gBehaviorProfile) - offsetof(struct BehaviorProfile, numEntries));
+}
+
+/**
+ * Handle the profiler controls and publish the profile of the frame that was
+ * just updated. Called at the end of update_objects.
+ */
+void update_behavior_profiler(void) {
+    s32 enabled = HOST_FIELD(gBehaviorProfile.enabled);
+    s32 sortKey = HOST_FIELD(gBehaviorProfile.sortKey);
+
+    if (sortKey >= BHV_PROFILE_SORT_COUNT) {
+        sortKey = BHV_PROFILE_SORT_CYCLES;
+    }
+
+    if (gPlayer3Controller->buttonPressed & L_TRIG) {
+        enabled ^= 1;
+        HOST_FIELD(gBehaviorProfile.enabled) = enabled;
+    }
+
+    if (gPlayer3Controller->buttonPressed & R_TRIG) {
+        sortKey = (sortKey + 1) % BHV_PROFILE_SORT_COUNT;
+        HOST_FIELD(gBehaviorProfile.sortKey) = sortKey;
+    }
+
+    gBehaviorProfilerEnabled = enabled;
+    sBhvProfileSortKey = sortKey;
+
+    if (gBehaviorProfilerEnabled) {
+        publish_behavior_profile();
+    }
+}
+
+/**
+ * Print the top rows of the behavior profile in the lower left of the screen,
+ * where it replaces the frame times of the profiler. The first row shows the
+ * sort key and the frame total. Each other row shows the low bits of the
+ * behavior's address and the value it is sorted by: its total or peak time in
+ * microseconds, or its number of calls.
+ */
+void print_behavior_profile(void) {
+    static const char *sSortKeyNames[] = { "TIME", "PEAK", "CALLS" };
+    struct BehaviorProfileEntry *entry;
+    s32 sortKey;
+    s32 y = 96;
+    s32 i;
+
+    if (!gBehaviorProfilerEnabled) {
+        return;
+    }
+
+    sortKey = sBhvProfileSortKey < ARRAY_COUNT(sSortKeyNames) ? sBhvProfileSortKey : 0;
+    print_text(20, y, sSortKeyNames[sortKey]);
+    if (sortKey == BHV_PROFILE_SORT_CALLS) {
+        print_text_fmt_int(104, y, "%d", gBehaviorProfile.totalCalls);
+    } else {
+        print_text_fmt_int(104, y, "%d", CYCLES_TO_USEC(gBehaviorProfile.totalCycles));
+    }
+
+    for (i = 0; i < gBehaviorProfile.numEntries && i < BHV_PROFILER_PRINT_ROWS; i++) {
+        entry = &gBehaviorProfile.entries[i];
+        y -= 16;
+
+        print_text_fmt_int(20, y, "%06x", (uintptr_t) entry->behavior & 0xFFFFFF);
+        switch (sortKey) {
+            case BHV_PROFILE_SORT_PEAK:
+                print_text_fmt_int(104, y, "%d", CYCLES_TO_USEC(entry->peakCycles));
+                break;
+            case BHV_PROFILE_SORT_CALLS:
+                print_text_fmt_int(104, y, "%d", entry->calls);
+                break;
+            default:
+                print_text_fmt_int(104, y, "%d", CYCLES_TO_USEC(entry->cycles));
+                break;
+        }
+    }
+}
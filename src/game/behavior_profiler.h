@@ -0,0 +1,58 @@
+#ifndef BEHAVIOR_PROFILER_H
+#define BEHAVIOR_PROFILER_H
+
+#include <PR/ultratypes.h>
+
+#include "types.h"
+
+/**
+ * The maximum number of distinct behaviors tracked in one frame. Behaviors
+ * beyond this are counted in the frame total but don't get a row.
+ */
+#define BHV_PROFILER_MAX_ENTRIES 64
+
+// Value of BehaviorProfile.magic, "BPRF"
+#define BHV_PROFILER_MAGIC 0x42505246
+
+enum BehaviorProfileSortKey {
+    BHV_PROFILE_SORT_CYCLES,
+    BHV_PROFILE_SORT_PEAK,
+    BHV_PROFILE_SORT_CALLS,
+    BHV_PROFILE_SORT_COUNT
+};
+
+struct BehaviorProfileEntry {
+    /*0x00*/ const BehaviorScript *behavior; // virtual address of the behavior script
+    /*0x04*/ u32 calls;                      // number of cur_obj_update calls this frame
+    /*0x08*/ u32 cycles;                     // total osGetTime ticks spent in those calls
+    /*0x0C*/ u32 peakCycles;                 // longest single call
+};
+
+/**
+ * The profile of the last completed frame, sorted by sortKey. This has a fixed
+ * layout and a magic number so that a host tool can find and read it from
+ * RDRAM. The host may also write enabled and sortKey. They share the first
+ * data cache line only with the constant magic, and the game accesses them
+ * uncached, so that a writeback of the profile never overwrites them.
+ */
+struct BehaviorProfile {
+    /*0x00*/ u32 magic;
+    /*0x04*/ u8 enabled;
+    /*0x05*/ u8 sortKey;
+    /*0x06*/ u8 filler06[10];
+    /*0x10*/ u16 numEntries;
+    /*0x12*/ u16 filler12;
+    /*0x14*/ u32 frame;       // gGlobalTimer when the profile was taken
+    /*0x18*/ u32 totalCycles; // time spent in all cur_obj_update calls
+    /*0x1C*/ u32 totalCalls;
+    /*0x20*/ struct BehaviorProfileEntry entries[BHV_PROFILER_MAX_ENTRIES];
+};
+
+extern struct BehaviorProfile gBehaviorProfile;
+extern s32 gBehaviorProfilerEnabled;
+
+void profile_cur_obj_update(void);
+void update_behavior_profiler(void);
+void print_behavior_profile(void);
+
+#endif // BEHAVIOR_PROFILER_H
@@ -24,7 +24,7 @@ void bhv_beta_fish_splash_spawner_loop(void) {
             break;
         case 1:
             if (water_level > -10000) {
-                if (gPrevFrameObjectCount < 212) {
+                if (gPrevFrameObjectCount < gObjectPoolCapacity - 28) {
                     if (gGlobalTimer % 32 == 0)
                         cur_obj_play_sound_2(SOUND_GENERAL_MOVING_WATER);
 
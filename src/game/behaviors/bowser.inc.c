@@ -1129,7 +1129,7 @@ s32 bowser_dead_wait_for_mario(void) {
  */
 s32 bowser_dead_twirl_up(void) {
     s32 ret = 0;
-    struct Object *mist;
+    s32 mist;
 
     o->oBowserEyesShut = TRUE;
 
@@ -1139,9 +1139,14 @@ s32 bowser_dead_twirl_up(void) {
         o->header.gfx.scale[2] = o->header.gfx.scale[2] - 0.03f;
     }
     if (o->header.gfx.scale[1] <= 0.0 && bowserTimer > 0) {
-        mist = spawn_object(o, MODEL_SMOKE, bhvWhitePuff1);
-        obj_translate_xz_random(mist, 64.0f);
-        mist->oPosY -= 70.0f;
+        mist = spawn_particle_at_object(o, MODEL_SMOKE, 11,
+                                        PARTICLE_FLAG_BILLBOARD | PARTICLE_FLAG_ANIMATE);
+        if (mist >= 0) {
+            gParticles->posX[mist] += random_f32_around_zero(64.0f);
+            gParticles->posZ[mist] += random_f32_around_zero(64.0f);
+            gParticles->posY[mist] -= 70.0f;
+            gParticles->scale[mist] = 3.0f;
+        }
     }
     if (o->header.gfx.scale[1] <= 0.0 && bowserTimer < 9) {
         bowserTimer++;
@@ -69,6 +69,7 @@ void bhv_spawned_star_loop(void) {
         if (o->oTimer == 0) {
             set_time_stop_flags(TIME_STOP_ENABLED | TIME_STOP_MARIO_AND_DOORS);
             o->activeFlags |= ACTIVE_FLAG_INITIATED_TIME_STOP;
+            obj_update_time_stop_exemption(o);
             o->oAngleVelYaw = 0x800;
             if (o->oBhvParams2ndByte == 0) {
                 set_home_to_mario();
@@ -108,6 +109,7 @@ void bhv_spawned_star_loop(void) {
         if (gCamera->cutscene == 0 && gRecentCutscene == 0) {
             clear_time_stop_flags(TIME_STOP_ENABLED | TIME_STOP_MARIO_AND_DOORS);
             o->activeFlags &= ~ACTIVE_FLAG_INITIATED_TIME_STOP;
+            obj_update_time_stop_exemption(o);
             o->oAction++;
         }
     } else {
@@ -19,7 +19,7 @@ void bhv_tree_snow_or_leaf_loop(void) {
     if (o->oTimer > 100) {
         obj_mark_for_deletion(o);
     }
-    if (gPrevFrameObjectCount > (OBJECT_POOL_CAPACITY - 28)) {
+    if (gPrevFrameObjectCount > (gObjectPoolCapacity - 28)) {
         obj_mark_for_deletion(o);
     }
 
@@ -43,23 +43,32 @@ void bhv_tree_snow_or_leaf_loop(void) {
     o->oPosY += o->oVelY;
 }
 
+/**
+ * Spawn a falling leaf particle. This approximates bhv_tree_snow_or_leaf_loop
+ * with fixed-function motion: the leaf tumbles, falls with a terminal
+ * velocity, slows down horizontally, and dies when it reaches the floor.
+ */
 void bhv_snow_leaf_particle_spawn_init(void) {
-    struct Object *obj; // Either snow or leaf
-    UNUSED u8 filler1[4];
-    f32 scale;
-    UNUSED u8 filler2[4];
+    s32 leaf;
 
     gMarioObject->oActiveParticleFlags &= ~ACTIVE_PARTICLE_LEAF;
 
     if (random_float() < 0.3) {
-        obj = spawn_object(o, MODEL_LEAVES, bhvTreeLeaf);
-        scale = random_float() * 3.0f;
-        obj_scale_xyz(obj, scale, scale, scale);
-        obj->oMoveAngleYaw = random_u16();
-        obj->oForwardVel = random_float() * 5.0f + 5.0f;
-        obj->oVelY = random_float() * 15.0f;
-        obj->oFaceAnglePitch = random_u16();
-        obj->oFaceAngleRoll = random_u16();
-        obj->oFaceAngleYaw = random_u16();
+        leaf = spawn_particle_at_object(o, MODEL_LEAVES, 101, PARTICLE_FLAG_DIE_BELOW_FLOOR);
+        if (leaf < 0) {
+            return;
+        }
+
+        gParticles->scale[leaf] = random_float() * 3.0f;
+        particle_set_forward_vel(leaf, random_u16(), random_float() * 5.0f + 5.0f);
+        gParticles->velY[leaf] = random_float() * 15.0f;
+        gParticles->gravity[leaf] = -3.0f;
+        gParticles->minVelY[leaf] = -8.0f;
+        gParticles->dragStrength[leaf] = 50.0f;
+        gParticles->angle[leaf][0] = random_u16();
+        gParticles->angle[leaf][1] = random_u16();
+        gParticles->angle[leaf][2] = random_u16();
+        gParticles->angleVel[leaf][0] = (random_float() - 0.5) * 0x1000;
+        gParticles->angleVel[leaf][2] = (random_float() - 0.5) * 0x1000;
     }
 }
@@ -25,6 +25,10 @@ static Gfx *sGfxCursor; // points to end of display list for bubble particles
 static s32 sBubbleParticleCount;
 static s32 sBubbleParticleMaxCount;
 
+#if ENVFX_MAX_PARTICLES < 60
+#error "ENVFX_MAX_PARTICLES must fit the 60 jet stream bubbles"
+#endif
+
 UNUSED s32 D_80330690 = 0;
 UNUSED s32 D_80330694 = 0;
 
@@ -41,8 +45,8 @@ Vtx_t gBubbleTempVtx[3] = {
  * kill flower and bubble particles.
  */
 s32 particle_is_laterally_close(s32 index, s32 x, s32 z, s32 distance) {
-    s32 xPos = (gEnvFxBuffer + index)->xPos;
-    s32 zPos = (gEnvFxBuffer + index)->zPos;
+    s32 xPos = gEnvFx.xPos[index];
+    s32 zPos = gEnvFx.zPos[index];
 
     if (sqr(xPos - x) + sqr(zPos - z) > sqr(distance)) {
         return FALSE;
@@ -80,18 +84,18 @@ void envfx_update_flower(Vec3s centerPos) {
     s16 centerZ = centerPos[2];
 
     for (i = 0; i < sBubbleParticleMaxCount; i++) {
-        (gEnvFxBuffer + i)->isAlive = particle_is_laterally_close(i, centerX, centerZ, 3000);
-        if (!(gEnvFxBuffer + i)->isAlive) {
-            (gEnvFxBuffer + i)->xPos = random_flower_offset() + centerX;
-            (gEnvFxBuffer + i)->zPos = random_flower_offset() + centerZ;
-            (gEnvFxBuffer + i)->yPos = find_floor_height_and_data((gEnvFxBuffer + i)->xPos, 10000.0f,
-                                                                  (gEnvFxBuffer + i)->zPos, &floorGeo);
-            (gEnvFxBuffer + i)->isAlive = TRUE;
-            (gEnvFxBuffer + i)->animFrame = random_float() * 5.0f;
+        gEnvFx.isAlive[i] = particle_is_laterally_close(i, centerX, centerZ, 3000);
+        if (!gEnvFx.isAlive[i]) {
+            gEnvFx.xPos[i] = random_flower_offset() + centerX;
+            gEnvFx.zPos[i] = random_flower_offset() + centerZ;
+            gEnvFx.yPos[i] = find_floor_height_and_data(gEnvFx.xPos[i], 10000.0f,
+                                                                  gEnvFx.zPos[i], &floorGeo);
+            gEnvFx.isAlive[i] = TRUE;
+            gEnvFx.animFrame[i] = random_float() * 5.0f;
         } else if (!(globalTimer & 3)) {
-            (gEnvFxBuffer + i)->animFrame += 1;
-            if ((gEnvFxBuffer + i)->animFrame > 5) {
-                (gEnvFxBuffer + i)->animFrame = 0;
+            gEnvFx.animFrame[i] += 1;
+            if (gEnvFx.animFrame[i] > 5) {
+                gEnvFx.animFrame[i] = 0;
             }
         }
     }
@@ -114,34 +118,34 @@ void envfx_set_lava_bubble_position(s32 index, Vec3s centerPos) {
     s16 centerY = centerPos[1];
     s16 centerZ = centerPos[2];
 
-    (gEnvFxBuffer + index)->xPos = random_float() * 6000.0f - 3000.0f + centerX;
-    (gEnvFxBuffer + index)->zPos = random_float() * 6000.0f - 3000.0f + centerZ;
+    gEnvFx.xPos[index] = random_float() * 6000.0f - 3000.0f + centerX;
+    gEnvFx.zPos[index] = random_float() * 6000.0f - 3000.0f + centerZ;
 
-    if ((gEnvFxBuffer + index)->xPos > 8000) {
-        (gEnvFxBuffer + index)->xPos = 16000 - (gEnvFxBuffer + index)->xPos;
+    if (gEnvFx.xPos[index] > 8000) {
+        gEnvFx.xPos[index] = 16000 - gEnvFx.xPos[index];
     }
-    if ((gEnvFxBuffer + index)->xPos < -8000) {
-        (gEnvFxBuffer + index)->xPos = -16000 - (gEnvFxBuffer + index)->xPos;
+    if (gEnvFx.xPos[index] < -8000) {
+        gEnvFx.xPos[index] = -16000 - gEnvFx.xPos[index];
     }
 
-    if ((gEnvFxBuffer + index)->zPos > 8000) {
-        (gEnvFxBuffer + index)->zPos = 16000 - (gEnvFxBuffer + index)->zPos;
+    if (gEnvFx.zPos[index] > 8000) {
+        gEnvFx.zPos[index] = 16000 - gEnvFx.zPos[index];
     }
-    if ((gEnvFxBuffer + index)->zPos < -8000) {
-        (gEnvFxBuffer + index)->zPos = -16000 - (gEnvFxBuffer + index)->zPos;
+    if (gEnvFx.zPos[index] < -8000) {
+        gEnvFx.zPos[index] = -16000 - gEnvFx.zPos[index];
     }
 
     floorY =
-        find_floor((gEnvFxBuffer + index)->xPos, centerY + 500, (gEnvFxBuffer + index)->zPos, &surface);
+        find_floor(gEnvFx.xPos[index], centerY + 500, gEnvFx.zPos[index], &surface);
     if (surface == NULL) {
-        (gEnvFxBuffer + index)->yPos = FLOOR_LOWER_LIMIT_MISC;
+        gEnvFx.yPos[index] = FLOOR_LOWER_LIMIT_MISC;
         return;
     }
 
     if (surface->type == SURFACE_BURNING) {
-        (gEnvFxBuffer + index)->yPos = floorY;
+        gEnvFx.yPos[index] = floorY;
     } else {
-        (gEnvFxBuffer + index)->yPos = FLOOR_LOWER_LIMIT_MISC;
+        gEnvFx.yPos[index] = FLOOR_LOWER_LIMIT_MISC;
     }
 }
 
@@ -159,14 +163,14 @@ void envfx_update_lava(Vec3s centerPos) {
     UNUSED s16 centerZ = centerPos[2];
 
     for (i = 0; i < sBubbleParticleMaxCount; i++) {
-        if (!(gEnvFxBuffer + i)->isAlive) {
+        if (!gEnvFx.isAlive[i]) {
             envfx_set_lava_bubble_position(i, centerPos);
-            (gEnvFxBuffer + i)->isAlive = TRUE;
+            gEnvFx.isAlive[i] = TRUE;
         } else if (!(globalTimer & 1)) {
-            (gEnvFxBuffer + i)->animFrame += 1;
-            if ((gEnvFxBuffer + i)->animFrame > 8) {
-                (gEnvFxBuffer + i)->isAlive = FALSE;
-                (gEnvFxBuffer + i)->animFrame = 0;
+            gEnvFx.animFrame[i] += 1;
+            if (gEnvFx.animFrame[i] > 8) {
+                gEnvFx.isAlive[i] = FALSE;
+                gEnvFx.animFrame[i] = 0;
             }
         }
     }
@@ -185,7 +189,7 @@ s32 envfx_is_jestream_bubble_alive(s32 index) {
 
     if (!particle_is_laterally_close(index, gEnvFxBubbleConfig[ENVFX_STATE_SRC_X],
                                      gEnvFxBubbleConfig[ENVFX_STATE_SRC_Z], 1000)
-        || gEnvFxBubbleConfig[ENVFX_STATE_SRC_Y] + 1500 < (gEnvFxBuffer + index)->yPos) {
+        || gEnvFxBubbleConfig[ENVFX_STATE_SRC_Y] + 1500 < gEnvFx.yPos[index]) {
         return FALSE;
     }
 
@@ -200,29 +204,29 @@ void envfx_update_jetstream(void) {
     s32 i;
 
     for (i = 0; i < sBubbleParticleMaxCount; i++) {
-        (gEnvFxBuffer + i)->isAlive = envfx_is_jestream_bubble_alive(i);
-        if (!(gEnvFxBuffer + i)->isAlive) {
-            (gEnvFxBuffer + i)->angleAndDist[1] = random_float() * 300.0f;
-            (gEnvFxBuffer + i)->angleAndDist[0] = random_u16();
-            (gEnvFxBuffer + i)->xPos =
+        gEnvFx.isAlive[i] = envfx_is_jestream_bubble_alive(i);
+        if (!gEnvFx.isAlive[i]) {
+            gEnvFx.dist[i] = random_float() * 300.0f;
+            gEnvFx.angle[i] = random_u16();
+            gEnvFx.xPos[i] =
                 gEnvFxBubbleConfig[ENVFX_STATE_SRC_X]
-                + sins((gEnvFxBuffer + i)->angleAndDist[0]) * (gEnvFxBuffer + i)->angleAndDist[1];
-            (gEnvFxBuffer + i)->zPos =
+                + sins(gEnvFx.angle[i]) * gEnvFx.dist[i];
+            gEnvFx.zPos[i] =
                 gEnvFxBubbleConfig[ENVFX_STATE_SRC_Z]
-                + coss((gEnvFxBuffer + i)->angleAndDist[0]) * (gEnvFxBuffer + i)->angleAndDist[1];
-            (gEnvFxBuffer + i)->yPos =
+                + coss(gEnvFx.angle[i]) * gEnvFx.dist[i];
+            gEnvFx.yPos[i] =
                 gEnvFxBubbleConfig[ENVFX_STATE_SRC_Y] + (random_float() * 400.0f - 200.0f);
         } else {
-            (gEnvFxBuffer + i)->angleAndDist[1] += 10;
-            (gEnvFxBuffer + i)->xPos += sins((gEnvFxBuffer + i)->angleAndDist[0]) * 10.0f;
-            (gEnvFxBuffer + i)->zPos += coss((gEnvFxBuffer + i)->angleAndDist[0]) * 10.0f;
-            (gEnvFxBuffer + i)->yPos -= ((gEnvFxBuffer + i)->angleAndDist[1] / 30) - 50;
+            gEnvFx.dist[i] += 10;
+            gEnvFx.xPos[i] += sins(gEnvFx.angle[i]) * 10.0f;
+            gEnvFx.zPos[i] += coss(gEnvFx.angle[i]) * 10.0f;
+            gEnvFx.yPos[i] -= (gEnvFx.dist[i] / 30) - 50;
         }
     }
 }
 
 /**
- * Initialize bubble (or flower) effect by allocating a buffer to store
+ * Initialize bubble (or flower) effect by clearing the buffer storing
  * the state of each particle and setting the initial and max count.
  * Analogous to init_snow_particles, but for bubbles.
  */
@@ -248,19 +252,13 @@ s32 envfx_init_bubble(s32 mode) {
             break;
     }
 
-    gEnvFxBuffer =
-        mem_pool_alloc(gEffectsMemoryPool, sBubbleParticleCount * sizeof(struct EnvFxParticle));
-    if (gEnvFxBuffer == NULL) {
-        return FALSE;
-    }
-
-    bzero(gEnvFxBuffer, sBubbleParticleCount * sizeof(struct EnvFxParticle));
+    bzero(&gEnvFx, sizeof(gEnvFx));
     bzero(gEnvFxBubbleConfig, sizeof(gEnvFxBubbleConfig));
 
     switch (mode) {
         case ENVFX_LAVA_BUBBLES:
             for (i = 0; i < sBubbleParticleCount; i++) {
-                (gEnvFxBuffer + i)->animFrame = random_float() * 7.0f;
+                gEnvFx.animFrame[i] = random_float() * 7.0f;
             }
             break;
     }
@@ -317,40 +315,6 @@ void envfx_bubbles_update_switch(s32 mode, Vec3s camTo, Vec3s vertex1, Vec3s ver
     }
 }
 
-/**
- * Append 15 vertices to 'gfx', which is enough for 5 bubbles starting at
- * 'index'. The 3 input vertices represent the rotated triangle around (0,0,0)
- * that will be translated to bubble positions to draw the bubble image
- */
-void append_bubble_vertex_buffer(Gfx *gfx, s32 index, Vec3s vertex1, Vec3s vertex2, Vec3s vertex3,
-                                 Vtx *template) {
-    s32 i = 0;
-    Vtx *vertBuf = alloc_display_list(15 * sizeof(Vtx));
-
-    if (vertBuf == NULL) {
-        return;
-    }
-
-    for (i = 0; i < 15; i += 3) {
-        vertBuf[i] = template[0];
-        (vertBuf + i)->v.ob[0] = (gEnvFxBuffer + (index + i / 3))->xPos + vertex1[0];
-        (vertBuf + i)->v.ob[1] = (gEnvFxBuffer + (index + i / 3))->yPos + vertex1[1];
-        (vertBuf + i)->v.ob[2] = (gEnvFxBuffer + (index + i / 3))->zPos + vertex1[2];
-
-        vertBuf[i + 1] = template[1];
-        (vertBuf + i + 1)->v.ob[0] = (gEnvFxBuffer + (index + i / 3))->xPos + vertex2[0];
-        (vertBuf + i + 1)->v.ob[1] = (gEnvFxBuffer + (index + i / 3))->yPos + vertex2[1];
-        (vertBuf + i + 1)->v.ob[2] = (gEnvFxBuffer + (index + i / 3))->zPos + vertex2[2];
-
-        vertBuf[i + 2] = template[2];
-        (vertBuf + i + 2)->v.ob[0] = (gEnvFxBuffer + (index + i / 3))->xPos + vertex3[0];
-        (vertBuf + i + 2)->v.ob[1] = (gEnvFxBuffer + (index + i / 3))->yPos + vertex3[1];
-        (vertBuf + i + 2)->v.ob[2] = (gEnvFxBuffer + (index + i / 3))->zPos + vertex3[2];
-    }
-
-    gSPVertex(gfx, VIRTUAL_TO_PHYSICAL(vertBuf), 15, 0);
-}
-
 /**
  * Appends to the enfvx display list a command setting the appropriate texture
  * for a specific particle. The display list is not passed as parameter but uses
@@ -358,17 +322,17 @@ void append_bubble_vertex_buffer(Gfx *gfx, s32 index, Vec3s vertex1, Vec3s verte
  */
 void envfx_set_bubble_texture(s32 mode, s16 index) {
     void **imageArr;
-    s16 frame = (gEnvFxBuffer + index)->animFrame;
+    s16 frame = gEnvFx.animFrame[index];
 
     switch (mode) {
         case ENVFX_FLOWERS:
             imageArr = segmented_to_virtual(&flower_bubbles_textures_ptr_0B002008);
-            frame = (gEnvFxBuffer + index)->animFrame;
+            frame = gEnvFx.animFrame[index];
             break;
 
         case ENVFX_LAVA_BUBBLES:
             imageArr = segmented_to_virtual(&lava_bubble_ptr_0B006020);
-            frame = (gEnvFxBuffer + index)->animFrame;
+            frame = gEnvFx.animFrame[index];
             break;
 
         case ENVFX_JETSTREAM_BUBBLES:
@@ -395,7 +359,9 @@ Gfx *envfx_update_bubble_particles(s32 mode, UNUSED Vec3s marioPos, Vec3s camFro
 
     Gfx *gfxStart = alloc_display_list(
         ((sBubbleParticleMaxCount / 5) * 10 + sBubbleParticleMaxCount + 3) * sizeof(Gfx));
-    if (gfxStart == NULL) {
+    Vtx *verts = alloc_display_list(sBubbleParticleMaxCount * 3 * sizeof(Vtx));
+
+    if (gfxStart == NULL || (verts == NULL && sBubbleParticleMaxCount != 0)) {
         return NULL;
     }
 
@@ -406,16 +372,15 @@ Gfx *envfx_update_bubble_particles(s32 mode, UNUSED Vec3s marioPos, Vec3s camFro
     rotate_triangle_vertices(vertex1, vertex2, vertex3, pitch, yaw);
 
     gSPDisplayList(sGfxCursor++, &tiny_bubble_dl_0B006D38);
+    envfx_make_particle_vertices(verts, sBubbleParticleMaxCount, vertex1, vertex2, vertex3,
+                                 (Vtx *) gBubbleTempVtx);
 
-    for (i = 0; i < sBubbleParticleMaxCount; i += 5) {
+    // Each vertex load shares the texture of its first particle
+    for (i = 0; i < sBubbleParticleMaxCount; i += ENVFX_PARTICLES_PER_LOAD) {
         gDPPipeSync(sGfxCursor++);
         envfx_set_bubble_texture(mode, i);
-        append_bubble_vertex_buffer(sGfxCursor++, i, vertex1, vertex2, vertex3, (Vtx *) gBubbleTempVtx);
-        gSP1Triangle(sGfxCursor++, 0, 1, 2, 0);
-        gSP1Triangle(sGfxCursor++, 3, 4, 5, 0);
-        gSP1Triangle(sGfxCursor++, 6, 7, 8, 0);
-        gSP1Triangle(sGfxCursor++, 9, 10, 11, 0);
-        gSP1Triangle(sGfxCursor++, 12, 13, 14, 0);
+        sGfxCursor = envfx_draw_particle_triangles(
+            sGfxCursor, verts, i, min(ENVFX_PARTICLES_PER_LOAD, sBubbleParticleMaxCount - i));
     }
 
     gSPDisplayList(sGfxCursor++, &tiny_bubble_dl_0B006AB0);
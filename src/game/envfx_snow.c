@@ -33,7 +33,7 @@ struct SnowFlakeVertex {
     s16 z;
 };
 
-struct EnvFxParticle *gEnvFxBuffer;
+struct EnvFxBuffer gEnvFx;
 Vec3i gSnowCylinderLastPos;
 s16 gSnowParticleCount;
 s16 gSnowParticleMaxCount;
@@ -57,7 +57,7 @@ extern void *tiny_bubble_dl_0B006A50;
 extern void *tiny_bubble_dl_0B006CD8;
 
 /**
- * Initialize snow particles by allocating a buffer for storing their state
+ * Initialize snow particles by clearing the buffer storing their state
  * and setting a start amount.
  */
 s32 envfx_init_snow(s32 mode) {
@@ -66,7 +66,7 @@ s32 envfx_init_snow(s32 mode) {
             return FALSE;
 
         case ENVFX_SNOW_NORMAL:
-            gSnowParticleMaxCount = 140;
+            gSnowParticleMaxCount = ENVFX_MAX_PARTICLES;
             gSnowParticleCount = 5;
             break;
 
@@ -76,18 +76,12 @@ s32 envfx_init_snow(s32 mode) {
             break;
 
         case ENVFX_SNOW_BLIZZARD:
-            gSnowParticleMaxCount = 140;
-            gSnowParticleCount = 140;
+            gSnowParticleMaxCount = ENVFX_MAX_PARTICLES;
+            gSnowParticleCount = ENVFX_MAX_PARTICLES;
             break;
     }
 
-    gEnvFxBuffer =
-        mem_pool_alloc(gEffectsMemoryPool, gSnowParticleMaxCount * sizeof(struct EnvFxParticle));
-    if (gEnvFxBuffer == NULL) {
-        return FALSE;
-    }
-
-    bzero(gEnvFxBuffer, gSnowParticleMaxCount * sizeof(struct EnvFxParticle));
+    bzero(&gEnvFx, sizeof(gEnvFx));
 
     gEnvFxMode = mode;
     return TRUE;
@@ -134,16 +128,10 @@ void envfx_update_snowflake_count(s32 mode, Vec3s marioPos) {
 }
 
 /**
- * Deallocate the buffer storing snow particles and set the environment effect
- * to none.
+ * Set the environment effect to none.
  */
-void envfx_cleanup_snow(void *snowParticleArray) {
-    if (gEnvFxMode != ENVFX_MODE_NONE) {
-        if (snowParticleArray) {
-            mem_pool_free(gEffectsMemoryPool, snowParticleArray);
-        }
-        gEnvFxMode = ENVFX_MODE_NONE;
-    }
+void envfx_cleanup_snow(void) {
+    gEnvFxMode = ENVFX_MODE_NONE;
 }
 
 /**
@@ -176,9 +164,9 @@ void pos_from_orbit(Vec3s origin, Vec3s result, s16 radius, s16 pitch, s16 yaw)
  * x, y and z.
  */
 s32 envfx_is_snowflake_alive(s32 index, s32 snowCylinderX, s32 snowCylinderY, s32 snowCylinderZ) {
-    s32 x = (gEnvFxBuffer + index)->xPos;
-    s32 y = (gEnvFxBuffer + index)->yPos;
-    s32 z = (gEnvFxBuffer + index)->zPos;
+    s32 x = gEnvFx.xPos[index];
+    s32 y = gEnvFx.yPos[index];
+    s32 z = gEnvFx.zPos[index];
 
     if (sqr(x - snowCylinderX) + sqr(z - snowCylinderZ) > sqr(300)) {
         return FALSE;
@@ -210,21 +198,22 @@ void envfx_update_snow_normal(s32 snowCylinderX, s32 snowCylinderY, s32 snowCyli
     s32 deltaX = snowCylinderX - gSnowCylinderLastPos[0];
     s32 deltaY = snowCylinderY - gSnowCylinderLastPos[1];
     s32 deltaZ = snowCylinderZ - gSnowCylinderLastPos[2];
+    // The parts of the movement that are the same for every snowflake
+    f32 spawnX = snowCylinderX - 200.0f + (s16) (deltaX * 2);
+    f32 spawnZ = snowCylinderZ - 200.0f + (s16) (deltaZ * 2);
+    f32 moveX = (s16) (deltaX / 1.2) - 1.0f;
+    f32 moveZ = (s16) (deltaZ / 1.2) - 1.0f;
+    s32 fall = 2 - (s16) (deltaY * 0.8);
 
     for (i = 0; i < gSnowParticleCount; i++) {
-        (gEnvFxBuffer + i)->isAlive =
-            envfx_is_snowflake_alive(i, snowCylinderX, snowCylinderY, snowCylinderZ);
-        if (!(gEnvFxBuffer + i)->isAlive) {
-            (gEnvFxBuffer + i)->xPos =
-                400.0f * random_float() - 200.0f + snowCylinderX + (s16) (deltaX * 2);
-            (gEnvFxBuffer + i)->zPos =
-                400.0f * random_float() - 200.0f + snowCylinderZ + (s16) (deltaZ * 2);
-            (gEnvFxBuffer + i)->yPos = 200.0f * random_float() + snowCylinderY;
-            (gEnvFxBuffer + i)->isAlive = TRUE;
+        if (!envfx_is_snowflake_alive(i, snowCylinderX, snowCylinderY, snowCylinderZ)) {
+            gEnvFx.xPos[i] = 400.0f * random_float() + spawnX;
+            gEnvFx.zPos[i] = 400.0f * random_float() + spawnZ;
+            gEnvFx.yPos[i] = 200.0f * random_float() + snowCylinderY;
         } else {
-            (gEnvFxBuffer + i)->xPos += random_float() * 2 - 1.0f + (s16) (deltaX / 1.2);
-            (gEnvFxBuffer + i)->yPos -= 2 - (s16) (deltaY * 0.8);
-            (gEnvFxBuffer + i)->zPos += random_float() * 2 - 1.0f + (s16) (deltaZ / 1.2);
+            gEnvFx.xPos[i] += random_float() * 2 + moveX;
+            gEnvFx.yPos[i] -= fall;
+            gEnvFx.zPos[i] += random_float() * 2 + moveZ;
         }
     }
 
@@ -244,21 +233,22 @@ void envfx_update_snow_blizzard(s32 snowCylinderX, s32 snowCylinderY, s32 snowCy
     s32 deltaX = snowCylinderX - gSnowCylinderLastPos[0];
     s32 deltaY = snowCylinderY - gSnowCylinderLastPos[1];
     s32 deltaZ = snowCylinderZ - gSnowCylinderLastPos[2];
+    // The parts of the movement that are the same for every snowflake
+    f32 spawnX = snowCylinderX - 200.0f + (s16) (deltaX * 2);
+    f32 spawnZ = snowCylinderZ - 200.0f + (s16) (deltaZ * 2);
+    f32 moveX = (s16) (deltaX / 1.2) - 1.0f + 20.0f;
+    f32 moveZ = (s16) (deltaZ / 1.2) - 1.0f;
+    s32 fall = 5 - (s16) (deltaY * 0.8);
 
     for (i = 0; i < gSnowParticleCount; i++) {
-        (gEnvFxBuffer + i)->isAlive =
-            envfx_is_snowflake_alive(i, snowCylinderX, snowCylinderY, snowCylinderZ);
-        if (!(gEnvFxBuffer + i)->isAlive) {
-            (gEnvFxBuffer + i)->xPos =
-                400.0f * random_float() - 200.0f + snowCylinderX + (s16) (deltaX * 2);
-            (gEnvFxBuffer + i)->zPos =
-                400.0f * random_float() - 200.0f + snowCylinderZ + (s16) (deltaZ * 2);
-            (gEnvFxBuffer + i)->yPos = 400.0f * random_float() - 200.0f + snowCylinderY;
-            (gEnvFxBuffer + i)->isAlive = TRUE;
+        if (!envfx_is_snowflake_alive(i, snowCylinderX, snowCylinderY, snowCylinderZ)) {
+            gEnvFx.xPos[i] = 400.0f * random_float() + spawnX;
+            gEnvFx.zPos[i] = 400.0f * random_float() + spawnZ;
+            gEnvFx.yPos[i] = 400.0f * random_float() - 200.0f + snowCylinderY;
         } else {
-            (gEnvFxBuffer + i)->xPos += random_float() * 2 - 1.0f + (s16) (deltaX / 1.2) + 20.0f;
-            (gEnvFxBuffer + i)->yPos -= 5 - (s16) (deltaY * 0.8);
-            (gEnvFxBuffer + i)->zPos += random_float() * 2 - 1.0f + (s16) (deltaZ / 1.2);
+            gEnvFx.xPos[i] += random_float() * 2 + moveX;
+            gEnvFx.yPos[i] -= fall;
+            gEnvFx.zPos[i] += random_float() * 2 + moveZ;
         }
     }
 
@@ -291,13 +281,10 @@ void envfx_update_snow_water(s32 snowCylinderX, s32 snowCylinderY, s32 snowCylin
     s32 i;
 
     for (i = 0; i < gSnowParticleCount; i++) {
-        (gEnvFxBuffer + i)->isAlive =
-            envfx_is_snowflake_alive(i, snowCylinderX, snowCylinderY, snowCylinderZ);
-        if (!(gEnvFxBuffer + i)->isAlive) {
-            (gEnvFxBuffer + i)->xPos = 400.0f * random_float() - 200.0f + snowCylinderX;
-            (gEnvFxBuffer + i)->zPos = 400.0f * random_float() - 200.0f + snowCylinderZ;
-            (gEnvFxBuffer + i)->yPos = 400.0f * random_float() - 200.0f + snowCylinderY;
-            (gEnvFxBuffer + i)->isAlive = TRUE;
+        if (!envfx_is_snowflake_alive(i, snowCylinderX, snowCylinderY, snowCylinderZ)) {
+            gEnvFx.xPos[i] = 400.0f * random_float() - 200.0f + snowCylinderX;
+            gEnvFx.zPos[i] = 400.0f * random_float() - 200.0f + snowCylinderZ;
+            gEnvFx.yPos[i] = 400.0f * random_float() - 200.0f + snowCylinderY;
         }
     }
 }
@@ -340,37 +327,59 @@ void rotate_triangle_vertices(Vec3s vertex1, Vec3s vertex2, Vec3s vertex3, s16 p
 }
 
 /**
- * Append 15 vertices to 'gfx', which is enough for 5 snowflakes starting at
- * 'index' in the buffer. The 3 input vertices represent the rotated triangle
- * around (0,0,0) that will be translated to snowflake positions to draw the
- * snowflake image.
+ * Make the vertices of the first 'count' particles, three per particle. The 3
+ * input vertices represent the rotated triangle around (0,0,0) that will be
+ * translated to the particle positions to draw the particle image.
  */
-void append_snowflake_vertex_buffer(Gfx *gfx, s32 index, Vec3s vertex1, Vec3s vertex2, Vec3s vertex3) {
-    s32 i = 0;
-    Vtx *vertBuf = (Vtx *) alloc_display_list(15 * sizeof(Vtx));
+void envfx_make_particle_vertices(Vtx *verts, s32 count, Vec3s vertex1, Vec3s vertex2, Vec3s vertex3,
+                                  Vtx *template) {
+    s32 i;
 
-    if (vertBuf == NULL) {
-        return;
+    for (i = 0; i < count; i++) {
+        s32 x = gEnvFx.xPos[i];
+        s32 y = gEnvFx.yPos[i];
+        s32 z = gEnvFx.zPos[i];
+
+        verts[0] = template[0];
+        verts[0].v.ob[0] = x + vertex1[0];
+        verts[0].v.ob[1] = y + vertex1[1];
+        verts[0].v.ob[2] = z + vertex1[2];
+
+        verts[1] = template[1];
+        verts[1].v.ob[0] = x + vertex2[0];
+        verts[1].v.ob[1] = y + vertex2[1];
+        verts[1].v.ob[2] = z + vertex2[2];
+
+        verts[2] = template[2];
+        verts[2].v.ob[0] = x + vertex3[0];
+        verts[2].v.ob[1] = y + vertex3[1];
+        verts[2].v.ob[2] = z + vertex3[2];
+        verts += 3;
     }
+}
 
-    for (i = 0; i < 15; i += 3) {
-        vertBuf[i] = gSnowTempVtx[0];
-        (vertBuf + i)->v.ob[0] = (gEnvFxBuffer + (index + i / 3))->xPos + vertex1[0];
-        (vertBuf + i)->v.ob[1] = (gEnvFxBuffer + (index + i / 3))->yPos + vertex1[1];
-        (vertBuf + i)->v.ob[2] = (gEnvFxBuffer + (index + i / 3))->zPos + vertex1[2];
-
-        vertBuf[i + 1] = gSnowTempVtx[1];
-        (vertBuf + i + 1)->v.ob[0] = (gEnvFxBuffer + (index + i / 3))->xPos + vertex2[0];
-        (vertBuf + i + 1)->v.ob[1] = (gEnvFxBuffer + (index + i / 3))->yPos + vertex2[1];
-        (vertBuf + i + 1)->v.ob[2] = (gEnvFxBuffer + (index + i / 3))->zPos + vertex2[2];
-
-        vertBuf[i + 2] = gSnowTempVtx[2];
-        (vertBuf + i + 2)->v.ob[0] = (gEnvFxBuffer + (index + i / 3))->xPos + vertex3[0];
-        (vertBuf + i + 2)->v.ob[1] = (gEnvFxBuffer + (index + i / 3))->yPos + vertex3[1];
-        (vertBuf + i + 2)->v.ob[2] = (gEnvFxBuffer + (index + i / 3))->zPos + vertex3[2];
-    }
+/**
+ * Append the commands drawing 'count' particles starting at 'index', with the
+ * vertices made by envfx_make_particle_vertices. Loads ENVFX_PARTICLES_PER_LOAD
+ * particles into the vertex buffer at a time.
+ */
+Gfx *envfx_draw_particle_triangles(Gfx *gfx, Vtx *verts, s32 index, s32 count) {
+    s32 i;
+    s32 j;
+    s32 batch;
 
-    gSPVertex(gfx, VIRTUAL_TO_PHYSICAL(vertBuf), 15, 0);
+    for (i = index; i < index + count; i += batch) {
+        batch = index + count - i;
+        if (batch > ENVFX_PARTICLES_PER_LOAD) {
+            batch = ENVFX_PARTICLES_PER_LOAD;
+        }
+
+        gSPVertex(gfx++, VIRTUAL_TO_PHYSICAL(verts + i * 3), batch * 3, 0);
+        for (j = 0; j < batch; j++) {
+            gSP1Triangle(gfx++, j * 3, j * 3 + 1, j * 3 + 2, 0);
+        }
+    }
+    return gfx;
 }
 
 /**
@@ -378,26 +387,29 @@ void append_snowflake_vertex_buffer(Gfx *gfx, s32 index, Vec3s vertex1, Vec3s ve
  * drawing all snowflakes.
  */
 Gfx *envfx_update_snow(s32 snowMode, Vec3s marioPos, Vec3s camFrom, Vec3s camTo) {
-    s32 i;
     s16 radius, pitch, yaw;
     Vec3s snowCylinderPos;
     struct SnowFlakeVertex vertex1, vertex2, vertex3;
     Gfx *gfxStart;
     Gfx *gfx;
+    Vtx *verts;
 
     vertex1 = gSnowFlakeVertex1;
     vertex2 = gSnowFlakeVertex2;
     vertex3 = gSnowFlakeVertex3;
 
-    gfxStart = (Gfx *) alloc_display_list((gSnowParticleCount * 6 + 3) * sizeof(Gfx));
+    envfx_update_snowflake_count(snowMode, marioPos);
+
+    gfxStart = (Gfx *) alloc_display_list(
+        ((gSnowParticleCount / ENVFX_PARTICLES_PER_LOAD + 1) * (ENVFX_PARTICLES_PER_LOAD + 1) + 3)
+        * sizeof(Gfx));
+    verts = (Vtx *) alloc_display_list(gSnowParticleCount * 3 * sizeof(Vtx));
     gfx = gfxStart;
 
-    if (gfxStart == NULL) {
+    if (gfxStart == NULL || (verts == NULL && gSnowParticleCount != 0)) {
         return NULL;
     }
 
-    envfx_update_snowflake_count(snowMode, marioPos);
-
     // Note: to and from are inverted here, so the resulting vector goes towards the camera
     orbit_from_positions(camTo, camFrom, &radius, &pitch, &yaw);
 
@@ -445,15 +457,9 @@ Gfx *envfx_update_snow(s32 snowMode, Vec3s marioPos, Vec3s camFrom, Vec3s camTo)
         gSPDisplayList(gfx++, &tiny_bubble_dl_0B006CD8); // snowflake with blue edge
     }
 
-    for (i = 0; i < gSnowParticleCount; i += 5) {
-        append_snowflake_vertex_buffer(gfx++, i, (s16 *) &vertex1, (s16 *) &vertex2, (s16 *) &vertex3);
-
-        gSP1Triangle(gfx++, 0, 1, 2, 0);
-        gSP1Triangle(gfx++, 3, 4, 5, 0);
-        gSP1Triangle(gfx++, 6, 7, 8, 0);
-        gSP1Triangle(gfx++, 9, 10, 11, 0);
-        gSP1Triangle(gfx++, 12, 13, 14, 0);
-    }
+    envfx_make_particle_vertices(verts, gSnowParticleCount, (s16 *) &vertex1, (s16 *) &vertex2,
+                                 (s16 *) &vertex3, gSnowTempVtx);
+    gfx = envfx_draw_particle_triangles(gfx, verts, 0, gSnowParticleCount);
 
     gSPDisplayList(gfx++, &tiny_bubble_dl_0B006AB0) gSPEndDisplayList(gfx++);
 
@@ -490,7 +496,7 @@ Gfx *envfx_update_particles(s32 mode, Vec3s marioPos, Vec3s camTo, Vec3s camFrom
 
     switch (mode) {
         case ENVFX_MODE_NONE:
-            envfx_cleanup_snow(gEnvFxBuffer);
+            envfx_cleanup_snow();
             return NULL;
 
         case ENVFX_SNOW_NORMAL:
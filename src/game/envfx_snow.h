@@ -16,27 +16,46 @@
 #define ENVFX_WHIRLPOOL_BUBBLES 13 // DDD
 #define ENVFX_JETSTREAM_BUBBLES 14 // JRB, DDD (submarine area)
 
-struct EnvFxParticle {
-    s8 isAlive;
-    s16 animFrame; // lava bubbles and flowers have frame animations
-    s32 xPos;
-    s32 yPos;
-    s32 zPos;
-    s32 angleAndDist[2]; // for whirpools, [0] = angle from center, [1] = distance from center
-    s32 unusedBubbleVar; // set to zero for bubbles when respawning, never used elsewhere
-    s32 bubbleY; // for Bubbles, yPos is always set to this
-    u8 filler[24];
+/**
+ * The maximum number of environment effect particles. Normal and blizzard snow
+ * build up to this many snowflakes. Configured in config.h.
+ */
+#ifndef ENVFX_MAX_PARTICLES
+#define ENVFX_MAX_PARTICLES 140
+#endif
+
+/**
+ * The number of particle triangles drawn per vertex load. 15 vertices fill the
+ * RSP's vertex buffer, which holds 16.
+ */
+#define ENVFX_PARTICLES_PER_LOAD 5
+
+/**
+ * Environment effect particle state, stored as a structure of arrays so that
+ * the update loops only touch the fields they need. Snow only uses the positions.
+ */
+struct EnvFxBuffer {
+    s32 xPos[ENVFX_MAX_PARTICLES];
+    s32 yPos[ENVFX_MAX_PARTICLES];
+    s32 zPos[ENVFX_MAX_PARTICLES];
+    s32 angle[ENVFX_MAX_PARTICLES];     // for jet streams, angle from the source
+    s32 dist[ENVFX_MAX_PARTICLES];      // for jet streams, distance from the source
+    s16 animFrame[ENVFX_MAX_PARTICLES]; // lava bubbles and flowers have frame animations
+    s8 isAlive[ENVFX_MAX_PARTICLES];
 };
 
 extern s8 gEnvFxMode;
 extern UNUSED s32 D_80330644;
 
-extern struct EnvFxParticle *gEnvFxBuffer;
+extern struct EnvFxBuffer gEnvFx;
 extern Vec3i gSnowCylinderLastPos;
 extern s16 gSnowParticleCount;
 
 Gfx *envfx_update_particles(s32 mode, Vec3s marioPos, Vec3s camTo, Vec3s camFrom);
 void orbit_from_positions(Vec3s from, Vec3s to, s16 *radius, s16 *pitch, s16 *yaw);
 void rotate_triangle_vertices(Vec3s vertex1, Vec3s vertex2, Vec3s vertex3, s16 pitch, s16 yaw);
+void envfx_make_particle_vertices(Vtx *verts, s32 count, Vec3s vertex1, Vec3s vertex2, Vec3s vertex3,
+                                  Vtx *template);
+Gfx *envfx_draw_particle_triangles(Gfx *gfx, Vtx *verts, s32 index, s32 count);
 
 #endif // ENVFX_SNOW_H
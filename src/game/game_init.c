@@ -288,12 +288,100 @@ void select_gfx_pool(void) {
     gGfxPoolEnd = (u8 *) (gGfxPool->buffer + GFX_POOL_SIZE);
 }
 
+#ifdef GFX_POOL_PROFILER
+struct GfxPoolProfile gGfxPoolProfile = { 0, 0, 0, 0, 0, 0, NULL, NULL, -1 };
+
+/**
+ * Record a failed display list allocation, and the graph node that made it.
+ */
+void gfx_pool_overflow(void) {
+    gGfxPoolProfile.overflows++;
+    gGfxPoolProfile.overflowNode = gGfxPoolProfile.curNode;
+    gGfxPoolProfile.overflowNodeType =
+        gGfxPoolProfile.curNode != NULL ? gGfxPoolProfile.curNode->type : -1;
+}
+
+/**
+ * Measure how much of the graphics pool the finished frame used and update
+ * the high-water marks. Called once the master display list is complete.
+ */
+void profile_gfx_pool(void) {
+    u8 *poolStart = (u8 *) gGfxPool->buffer;
+    u8 *poolEnd = (u8 *) (gGfxPool->buffer + GFX_POOL_SIZE);
+    u32 total;
+
+    gGfxPoolProfile.headUsed = (u8 *) gDisplayListHead - poolStart;
+    gGfxPoolProfile.tailUsed = poolEnd - gGfxPoolEnd;
+    total = gGfxPoolProfile.headUsed + gGfxPoolProfile.tailUsed;
+
+    // Display list commands are written without a bounds check, so an
+    // overflow of the head can only be noticed after the fact.
+    if (total > GFX_POOL_SIZE * sizeof(Gfx)) {
+        rmonpf(("Display list overflow\n"));
+        gfx_pool_overflow();
+    }
+
+    if (gGfxPoolProfile.headUsed > gGfxPoolProfile.headPeak) {
+        gGfxPoolProfile.headPeak = gGfxPoolProfile.headUsed;
+    }
+    if (gGfxPoolProfile.tailUsed > gGfxPoolProfile.tailPeak) {
+        gGfxPoolProfile.tailPeak = gGfxPoolProfile.tailUsed;
+    }
+    if (total > gGfxPoolProfile.totalPeak) {
+        gGfxPoolProfile.totalPeak = total;
+    }
+    gGfxPoolProfile.curNode = NULL;
+}
+
+/**
+ * Print the graphics pool usage in Gfx commands, which is the unit of GFX_POOL_SIZE,
+ * in the upper left of the screen below the HUD. Overflows are always reported.
+ */
+static void print_gfx_pool_profile(void) {
+    if (gShowDebugText) {
+        print_text_fmt_int(20, 192, "HEAD %d", gGfxPoolProfile.headUsed / sizeof(Gfx));
+        print_text_fmt_int(20, 176, "TAIL %d", gGfxPoolProfile.tailUsed / sizeof(Gfx));
+        print_text_fmt_int(20, 160, "PEAK %d", gGfxPoolProfile.totalPeak / sizeof(Gfx));
+        // 1/8 of headroom, rounded up to a multiple of 64 commands
+        print_text_fmt_int(20, 144, "FIT %d",
+                           ((gGfxPoolProfile.totalPeak / sizeof(Gfx)) * 9 / 8 + 63) & ~63);
+    }
+    if (gGfxPoolProfile.overflows != 0) {
+        print_text_fmt_int(20, 128, "GFX OVF %d", gGfxPoolProfile.overflows);
+        print_text_fmt_int(20, 112, "NODE %x", gGfxPoolProfile.overflowNodeType);
+    }
+}
+#endif
+
+#ifdef FRAME_PACING_DECOUPLED
+/**
+ * gNumVblanks when the last frame was sent to the VI.
+ */
+static u32 sSwapVblank;
+
+/**
+ * Block the game loop until at least 'count' vblanks have passed since the last
+ * buffer swap was requested.
+ */
+static void wait_vblanks_since_swap(u32 count) {
+    while (gNumVblanks - sSwapVblank < count) {
+        osRecvMesg(&gGameVblankQueue, &gMainReceivedMesg, OS_MESG_BLOCK);
+    }
+}
+#endif
+
 /**
  * This function:
  * - Sends the current master display list out to be rendered.
  * - Tells the VI which color framebuffer to be displayed.
  * - Yields to the VI framerate twice, locking the game at 30 FPS.
  * - Selects which framebuffer will be rendered and displayed to next time.
+ *
+ * With FRAME_PACING_DECOUPLED, it only waits for as many vblanks as are still
+ * needed: the swap is requested once the last frame has been on screen for two
+ * vblanks, and the next frame's game logic starts without waiting for the swap to
+ * take effect. The framebuffer it renders to is only freed by that swap, so the
+ * wait for it happens right before its display list is sent.
  */
 void display_and_vsync(void) {
     profiler_log_thread5_time(BEFORE_DISPLAY_LISTS);
@@ -302,12 +390,25 @@ void display_and_vsync(void) {
         gGoddardVblankCallback();
         gGoddardVblankCallback = NULL;
     }
+#ifdef FRAME_PACING_DECOUPLED
+    wait_vblanks_since_swap(1);
+#endif
     exec_display_list(&gGfxPool->spTask);
     profiler_log_thread5_time(AFTER_DISPLAY_LISTS);
+#ifdef FRAME_PACING_DECOUPLED
+    wait_vblanks_since_swap(2);
+    osViSwapBuffer((void *) PHYSICAL_TO_VIRTUAL(gPhysicalFramebuffers[sRenderedFramebuffer]));
+    // Read after the swap, so that it never predates the vblank the swap takes effect on
+    sSwapVblank = gNumVblanks;
+    profiler_log_present();
+    profiler_log_thread5_time(THREAD5_END);
+#else
     osRecvMesg(&gGameVblankQueue, &gMainReceivedMesg, OS_MESG_BLOCK);
     osViSwapBuffer((void *) PHYSICAL_TO_VIRTUAL(gPhysicalFramebuffers[sRenderedFramebuffer]));
+    profiler_log_present();
     profiler_log_thread5_time(THREAD5_END);
     osRecvMesg(&gGameVblankQueue, &gMainReceivedMesg, OS_MESG_BLOCK);
+#endif
     if (++sRenderedFramebuffer == 3) {
         sRenderedFramebuffer = 0;
     }
@@ -519,6 +620,9 @@ void thread5_game_loop(UNUSED void *arg) {
         handle_debug_key_sequences();
 #endif
         addr = level_script_execute(addr);
+#ifdef GFX_POOL_PROFILER
+        profile_gfx_pool();
+#endif
 
         display_and_vsync();
 
@@ -528,5 +632,8 @@ void thread5_game_loop(UNUSED void *arg) {
             // amount of free space remaining.
             print_text_fmt_int(180, 20, "BUF %d", gGfxPoolEnd - (u8 *) gDisplayListHead);
         }
+#ifdef GFX_POOL_PROFILER
+        print_gfx_pool_profile();
+#endif
     }
 }
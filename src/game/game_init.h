@@ -9,7 +9,9 @@
 #include "types.h"
 #include "memory.h"
 
+#ifndef GFX_POOL_SIZE
 #define GFX_POOL_SIZE 6400 // Size of how large the master display list (gDisplayListHead) can be
+#endif
 
 struct GfxPool {
     Gfx buffer[GFX_POOL_SIZE];
@@ -31,6 +33,26 @@ extern struct SPTask *gGfxSPTask;
 extern Gfx *gDisplayListHead;
 extern u8 *gGfxPoolEnd;
 extern struct GfxPool *gGfxPool;
+#ifdef GFX_POOL_PROFILER
+/**
+ * Graphics pool usage, in bytes. The master display list grows up from the
+ * start of the pool and alloc_display_list allocates down from its end, so
+ * the frame overflows when the two meet.
+ */
+struct GfxPoolProfile {
+    u32 headUsed;
+    u32 tailUsed;
+    u32 headPeak;
+    u32 tailPeak;
+    u32 totalPeak;
+    u32 overflows;
+    struct GraphNode *curNode;      // graph node being rendered, NULL outside the scene graph
+    struct GraphNode *overflowNode; // graph node being rendered when the pool last overflowed
+    s16 overflowNodeType;           // -1 if the pool overflowed outside the scene graph
+};
+
+extern struct GfxPoolProfile gGfxPoolProfile;
+#endif
 extern u8 gControllerBits;
 extern s8 gEepromProbe;
 
@@ -58,5 +80,9 @@ void end_master_display_list(void);
 void render_init(void);
 void select_gfx_pool(void);
 void display_and_vsync(void);
+#ifdef GFX_POOL_PROFILER
+void gfx_pool_overflow(void);
+void profile_gfx_pool(void);
+#endif
 
 #endif // GAME_INIT_H
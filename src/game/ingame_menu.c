@@ -719,6 +719,119 @@ void handle_dialog_text_and_pages(struct DialogEntry *dialog) {
     gLastDialogLineNum = lineNum;
 }
 
+#ifdef DIALOG_PAGE_CACHE
+/**
+ * The text of the open dialog page, compiled into a display list that is replayed
+ * every frame until the page changes. A page is drawn normally once first, which
+ * measures how much display list and matrix/texture memory it needs; it's compiled
+ * on the next frame if it fits. Scrolling pages are always drawn normally.
+ */
+struct DialogPageCache {
+    /// The page that was measured or compiled
+    s16 dialogID;
+    s16 pageStartStrIndex;
+    s32 dialogVariable;
+    /// What handle_dialog_text_and_pages left in gNextDialogPageStartStrIndex and gLastDialogLineNum
+    s16 nextPageStartStrIndex;
+    s8 lastLineNum;
+    /// Whether the page is in sDialogPageBuffer, or only measured
+    s8 compiled;
+    /// Memory the page took from the display list pool, or 0 if it doesn't fit
+    u32 gfxSize;
+    u32 dataSize;
+    /// gGlobalTimer of the last frame sDialogPageBuffer was drawn in
+    u32 frame;
+};
+
+static struct DialogPageCache sDialogPageCache = { DIALOG_NONE, 0, 0, 0, 0, FALSE, 0, 0, 0 };
+
+/**
+ * The compiled page: its display list grows up from the start and its matrices and
+ * textures grow down from the end, the same way as in the display list pool.
+ * It's allocated from the main pool when the first page is compiled and freed once
+ * the dialog has closed, see free_dialog_page_buffer, or along with the level.
+ */
+static u64 *sDialogPageBuffer = NULL;
+
+/**
+ * Free the compiled page buffer after the dialog has closed, once the RSP is done
+ * with the last frame that drew it.
+ */
+static void free_dialog_page_buffer(void) {
+    if (sDialogPageBuffer != NULL && gGlobalTimer - sDialogPageCache.frame >= 2) {
+        main_pool_free(sDialogPageBuffer);
+        reset_dialog_page_cache();
+    }
+}
+
+/**
+ * Forget the compiled page. Called when the level is cleared, since the buffer
+ * was allocated after the level's main pool state was pushed, and is freed when
+ * it is popped.
+ */
+void reset_dialog_page_cache(void) {
+    sDialogPageBuffer = NULL;
+    sDialogPageCache.dialogID = DIALOG_NONE;
+    sDialogPageCache.compiled = FALSE;
+}
+
+/**
+ * Render the text of the current dialog page, from the compiled page when possible.
+ */
+static void render_dialog_page_text(struct DialogEntry *dialog) {
+    struct DialogPageCache *cache = &sDialogPageCache;
+    Gfx *head = gDisplayListHead;
+    u8 *end = gGfxPoolEnd;
+    s32 samePage = cache->dialogID == gDialogID && cache->pageStartStrIndex == gDialogPageStartStrIndex
+                   && cache->dialogVariable == gDialogVariable;
+
+    if (gMenuState != MENU_STATE_DIALOG_OPEN) {
+        handle_dialog_text_and_pages(dialog);
+        return;
+    }
+
+    if (!samePage || !cache->compiled) {
+        if (samePage && cache->gfxSize != 0 && gGlobalTimer - cache->frame >= 2
+            && (sDialogPageBuffer != NULL
+                || (sDialogPageBuffer = main_pool_alloc(DIALOG_PAGE_CACHE_SIZE, MEMORY_POOL_RIGHT))
+                       != NULL)) {
+            // Same allocations as when the page was measured, so it can't overflow
+            gDisplayListHead = (Gfx *) sDialogPageBuffer;
+            gGfxPoolEnd = (u8 *) sDialogPageBuffer + DIALOG_PAGE_CACHE_SIZE;
+            handle_dialog_text_and_pages(dialog);
+            gSPEndDisplayList(gDisplayListHead++);
+            gDisplayListHead = head;
+            gGfxPoolEnd = end;
+            cache->compiled = TRUE;
+        } else {
+            handle_dialog_text_and_pages(dialog);
+
+            cache->dialogID = gDialogID;
+            cache->pageStartStrIndex = gDialogPageStartStrIndex;
+            cache->dialogVariable = gDialogVariable;
+            cache->nextPageStartStrIndex = gNextDialogPageStartStrIndex;
+            cache->lastLineNum = gLastDialogLineNum;
+            cache->compiled = FALSE;
+            cache->gfxSize = (u8 *) gDisplayListHead - (u8 *) head + sizeof(Gfx);
+            cache->dataSize = end - gGfxPoolEnd;
+
+            // Only compile pages that were drawn completely (the largest allocation
+            // is a glyph texture) and fit in the buffer
+            if (gGfxPoolEnd - (u8 *) gDisplayListHead < 8 * 16
+                || cache->gfxSize + cache->dataSize > DIALOG_PAGE_CACHE_SIZE) {
+                cache->gfxSize = 0;
+            }
+            return;
+        }
+    }
+
+    gSPDisplayList(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(sDialogPageBuffer));
+    gNextDialogPageStartStrIndex = cache->nextPageStartStrIndex;
+    gLastDialogLineNum = cache->lastLineNum;
+    cache->frame = gGlobalTimer;
+}
+#endif
+
 #define X_VAL4_1 50
 #define X_VAL4_2 25
 #define Y_VAL4_1 1
@@ -931,7 +1044,11 @@ void render_dialog_entries(void) {
 #endif
                   ensure_nonnegative((240 - dialog->width) + (dialog->linesPerBox * 80 / DIAG_VAL4)));
 
+#ifdef DIALOG_PAGE_CACHE
+    render_dialog_page_text(dialog);
+#else
     handle_dialog_text_and_pages(dialog);
+#endif
 
     if (gNextDialogPageStartStrIndex == -1 && gDialogWithChoice == TRUE) {
         render_dialog_triangle_choice();
@@ -1175,5 +1292,11 @@ s16 render_menus_and_dialogs(void) {
         render_dialog_entries();
     }
 
+#ifdef DIALOG_PAGE_CACHE
+    if (gDialogID == DIALOG_NONE) {
+        free_dialog_page_buffer();
+    }
+#endif
+
     return index;
 }
@@ -127,5 +127,8 @@ void print_credits_str_ascii(s16 x, s16 y, const char *str);
 void set_cutscene_message(s16 xOffset, s16 yOffset, s16 msgIndex, s16 msgDuration);
 void do_cutscene_handler(void);
 s16 render_menus_and_dialogs(void);
+#ifdef DIALOG_PAGE_CACHE
+void reset_dialog_page_cache(void);
+#endif
 
 #endif // INGAME_MENU_H
@@ -5,6 +5,7 @@
 #include "macro_special_objects.h"
 #include "object_list_processor.h"
 #include "behavior_data.h"
+#include "spawn_object.h"
 
 #include "macro_presets.inc.c"
 #include "special_presets.inc.c"
@@ -113,6 +114,8 @@ void spawn_macro_objects(s16 areaIndex, s16 *macroObjList) {
     gMacroObjectDefaultParent.header.gfx.areaIndex = areaIndex;
     gMacroObjectDefaultParent.header.gfx.activeAreaIndex = areaIndex;
 
+    begin_object_spawn_batch();
+
     while (TRUE) {
         if (*macroObjList == -1) { // An encountered value of -1 means the list has ended.
             break;
@@ -167,6 +170,8 @@ void spawn_macro_objects(s16 areaIndex, s16 *macroObjList) {
             newObj->parentObj = newObj;
         }
     }
+
+    end_object_spawn_batch();
 }
 
 void spawn_macro_objects_hardcoded(s16 areaIndex, s16 *macroObjList) {
@@ -185,6 +190,8 @@ void spawn_macro_objects_hardcoded(s16 areaIndex, s16 *macroObjList) {
     gMacroObjectDefaultParent.header.gfx.areaIndex = areaIndex;
     gMacroObjectDefaultParent.header.gfx.activeAreaIndex = areaIndex;
 
+    begin_object_spawn_batch();
+
     while (TRUE) {
         macroObjPreset = *macroObjList++;
 
@@ -212,6 +219,8 @@ void spawn_macro_objects_hardcoded(s16 areaIndex, s16 *macroObjList) {
                 break;
         }
     }
+
+    end_object_spawn_batch();
 }
 
 void spawn_special_objects(s16 areaIndex, TerrainData **specialObjList) {
@@ -234,6 +243,8 @@ void spawn_special_objects(s16 areaIndex, TerrainData **specialObjList) {
     gMacroObjectDefaultParent.header.gfx.areaIndex = areaIndex;
     gMacroObjectDefaultParent.header.gfx.activeAreaIndex = areaIndex;
 
+    begin_object_spawn_batch();
+
     for (i = 0; i < numOfSpecialObjects; i++) {
         presetID = (u8) * *specialObjList;
         (*specialObjList)++;
@@ -299,6 +310,8 @@ void spawn_special_objects(s16 areaIndex, TerrainData **specialObjList) {
                 break;
         }
     }
+
+    end_object_spawn_batch();
 }
 
 #ifdef NO_SEGMENTED_MEMORY
@@ -47,6 +47,8 @@ struct SPTask *sCurrentDisplaySPTask = NULL;
 struct SPTask *sNextAudioSPTask = NULL;
 struct SPTask *sNextDisplaySPTask = NULL;
 u32 gNumVblanks = 0;
+// osGetTime() of the last few vblanks, indexed by gNumVblanks
+OSTime gVblankTimes[8];
 s16 audCheck = 0;
 s8 gDebugLevelSelect = 0;
 s8 sysGvdActive = 0;
@@ -152,6 +154,241 @@ void create_thread(OSThread *thread, OSId id, void (*entry)(void *), void *arg,
     osCreateThread(thread, id, entry, arg, sp, pri);
 }
 
+#ifdef SPTASK_SCHEDULER
+/**
+ * SP task scheduler. Tasks sent to gSPTaskMesgQueue are queued with a priority and
+ * a deadline taken from their type, and the RSP runs the queued task with the
+ * highest priority first, then the one with the earliest deadline. A running gfx
+ * task yields when a task with a higher priority arrives; other tasks always run to
+ * completion. A gfx task also waits for the RDP to finish the previous one.
+ *
+ * Tasks of any other type than audio and gfx are compute tasks. They are sent with
+ * dispatch_sptask(), run whenever the RSP has nothing more important to do, and
+ * their message is sent as soon as the RSP is done with them.
+ */
+
+// Task priorities, higher runs first
+#define SPTASK_PRIORITY_COMPUTE 0
+#define SPTASK_PRIORITY_GFX 1
+#define SPTASK_PRIORITY_AUDIO 2
+
+struct SPTaskQueueEntry {
+    struct SPTask *spTask;
+    s8 priority;
+    /// gNumVblanks by which the task should be done, or 0 if it has no deadline
+    u32 deadline;
+};
+
+static struct SPTaskQueueEntry sSPTaskQueue[SPTASK_QUEUE_SIZE];
+static s32 sSPTaskQueueCount = 0;
+/// The queue entry of gActiveSPTask
+static struct SPTaskQueueEntry sActiveSPTaskEntry;
+/// The deadline of sCurrentDisplaySPTask
+static u32 sCurrentDisplayDeadline;
+/// When gActiveSPTask was asked to yield
+static OSTime sYieldRequestTime;
+
+struct SPTaskStats gSPTaskStats = { 0, 0, 0 };
+
+/**
+ * Move the tasks sent to gSPTaskMesgQueue into the queue. One slot is kept free
+ * for the running task, in case it yields.
+ */
+void receive_new_tasks(void) {
+    struct SPTaskQueueEntry *entry;
+    struct SPTask *spTask;
+
+    while (sSPTaskQueueCount < SPTASK_QUEUE_SIZE - 1
+           && osRecvMesg(&gSPTaskMesgQueue, (OSMesg *) &spTask, OS_MESG_NOBLOCK) != -1) {
+        spTask->state = SPTASK_STATE_NOT_STARTED;
+        entry = &sSPTaskQueue[sSPTaskQueueCount++];
+        entry->spTask = spTask;
+
+        switch (spTask->task.t.type) {
+            case M_AUDTASK:
+                // Done before the next vblank, when the next one is made
+                entry->priority = SPTASK_PRIORITY_AUDIO;
+                entry->deadline = gNumVblanks + 1;
+                break;
+            case M_GFXTASK:
+                // Done in time to be shown two vblanks from now
+                entry->priority = SPTASK_PRIORITY_GFX;
+                entry->deadline = gNumVblanks + 2;
+                break;
+            default:
+                entry->priority = SPTASK_PRIORITY_COMPUTE;
+                entry->deadline = 0;
+                break;
+        }
+    }
+}
+
+/**
+ * Return whether entry 'a' should run before entry 'b' of the same priority.
+ */
+static s32 sptask_deadline_before(struct SPTaskQueueEntry *a, struct SPTaskQueueEntry *b) {
+    if (a->deadline == 0) {
+        return FALSE;
+    }
+    return b->deadline == 0 || (s32) (a->deadline - b->deadline) < 0;
+}
+
+/**
+ * Return the index of the queued task that should run next, or -1 if none can.
+ */
+static s32 select_next_sptask(void) {
+    struct SPTaskQueueEntry *entry;
+    s32 best = -1;
+    s32 i;
+
+    for (i = 0; i < sSPTaskQueueCount; i++) {
+        entry = &sSPTaskQueue[i];
+
+        // A yielded gfx task is sCurrentDisplaySPTask itself
+        if (entry->spTask->task.t.type == M_GFXTASK && sCurrentDisplaySPTask != NULL
+            && sCurrentDisplaySPTask != entry->spTask) {
+            continue;
+        }
+
+        if (best < 0 || entry->priority > sSPTaskQueue[best].priority
+            || (entry->priority == sSPTaskQueue[best].priority
+                && sptask_deadline_before(entry, &sSPTaskQueue[best]))) {
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * Take the task at 'index' out of the queue and start or resume it.
+ */
+void start_sptask(s32 index) {
+    s32 i;
+
+    sActiveSPTaskEntry = sSPTaskQueue[index];
+    for (i = index + 1; i < sSPTaskQueueCount; i++) {
+        sSPTaskQueue[i - 1] = sSPTaskQueue[i];
+    }
+    sSPTaskQueueCount--;
+
+    gActiveSPTask = sActiveSPTaskEntry.spTask;
+    switch (gActiveSPTask->task.t.type) {
+        case M_AUDTASK:
+            rmonpf(("(AUD) start\n"));
+            audCheck = 1;
+            profiler_log_vblank_time();
+            break;
+        case M_GFXTASK:
+            rmonpf(("(GFX) strat\n"));
+            if (gActiveSPTask->state != SPTASK_STATE_INTERRUPTED) {
+                sCurrentDisplaySPTask = gActiveSPTask;
+                sCurrentDisplayDeadline = sActiveSPTaskEntry.deadline;
+                profiler_log_gfx_time(TASKS_QUEUED);
+            }
+            break;
+    }
+
+    osSpTaskLoad(&gActiveSPTask->task);
+    osSpTaskStartGo(&gActiveSPTask->task);
+    gActiveSPTask->state = SPTASK_STATE_RUNNING;
+}
+
+/**
+ * Start the next task if the RSP is free, or make the running gfx task yield if a
+ * task with a higher priority is waiting.
+ */
+void schedule_sptasks(void) {
+    s32 next = select_next_sptask();
+
+    if (next < 0) {
+        return;
+    }
+
+    if (gActiveSPTask == NULL) {
+        start_sptask(next);
+    } else if (gActiveSPTask->task.t.type == M_GFXTASK && gActiveSPTask->state == SPTASK_STATE_RUNNING
+               && sSPTaskQueue[next].priority > sActiveSPTaskEntry.priority) {
+        rmonpf(("(GFX) yield\n"));
+        gActiveSPTask->state = SPTASK_STATE_INTERRUPTED;
+        sYieldRequestTime = osGetTime();
+        osSpTaskYield();
+    }
+}
+
+/**
+ * Record a task that finished after its deadline.
+ */
+static void check_sptask_deadline(u32 deadline) {
+    if (deadline != 0 && (s32) (gNumVblanks - deadline) >= 0) {
+        gSPTaskStats.deadlineMisses++;
+    }
+}
+
+void handle_vblank(void) {
+    gNumVblanks++;
+    gVblankTimes[gNumVblanks % ARRAY_COUNT(gVblankTimes)] = osGetTime();
+
+    receive_new_tasks();
+    schedule_sptasks();
+
+    // Notify the game loop about the vblank.
+    if (gVblankHandler1 != NULL) {
+        osSendMesg(gVblankHandler1->queue, gVblankHandler1->msg, OS_MESG_NOBLOCK);
+    }
+    if (gVblankHandler2 != NULL) {
+        osSendMesg(gVblankHandler2->queue, gVblankHandler2->msg, OS_MESG_NOBLOCK);
+    }
+}
+
+void handle_sp_complete(void) {
+    struct SPTask *curSPTask = gActiveSPTask;
+
+    gActiveSPTask = NULL;
+
+    if (curSPTask->state == SPTASK_STATE_INTERRUPTED && osSpTaskYielded(&curSPTask->task)) {
+        // Back into the queue, it resumes once nothing more important is waiting
+        gSPTaskStats.yields++;
+        gSPTaskStats.yieldTime += osGetTime() - sYieldRequestTime;
+        sSPTaskQueue[sSPTaskQueueCount++] = sActiveSPTaskEntry;
+    } else {
+        // An interrupted task may also have completed before it could yield
+        curSPTask->state = SPTASK_STATE_FINISHED;
+
+        if (curSPTask->task.t.type == M_GFXTASK) {
+            // The task is done once the RDP is, in handle_dp_complete
+            profiler_log_gfx_time(RSP_COMPLETE);
+        } else {
+            if (curSPTask->task.t.type == M_AUDTASK) {
+                rmonpf(("(AUD) end\n"));
+                audCheck = 0;
+                profiler_log_vblank_time();
+            }
+            check_sptask_deadline(sActiveSPTaskEntry.deadline);
+            if (curSPTask->msgqueue != NULL) {
+                osSendMesg(curSPTask->msgqueue, curSPTask->msg, OS_MESG_NOBLOCK);
+            }
+        }
+    }
+
+    receive_new_tasks();
+    schedule_sptasks();
+}
+
+void handle_dp_complete(void) {
+    // Gfx SP task is completely done.
+    if (sCurrentDisplaySPTask->msgqueue != NULL) {
+        osSendMesg(sCurrentDisplaySPTask->msgqueue, sCurrentDisplaySPTask->msg, OS_MESG_NOBLOCK);
+    }
+    rmonpf(("(GFX) end\n"));
+    profiler_log_gfx_time(RDP_COMPLETE);
+    check_sptask_deadline(sCurrentDisplayDeadline);
+    sCurrentDisplaySPTask->state = SPTASK_STATE_FINISHED_DP;
+    sCurrentDisplaySPTask = NULL;
+
+    schedule_sptasks();
+}
+#else
 void receive_new_tasks(void) {
     struct SPTask *spTask;
 
@@ -216,6 +453,7 @@ void handle_vblank(void) {
     UNUSED u8 filler[4];
 
     gNumVblanks++;
+    gVblankTimes[gNumVblanks % ARRAY_COUNT(gVblankTimes)] = osGetTime();
 
     receive_new_tasks();
 
@@ -310,6 +548,7 @@ void handle_dp_complete(void) {
     sCurrentDisplaySPTask->state = SPTASK_STATE_FINISHED_DP;
     sCurrentDisplaySPTask = NULL;
 }
+#endif
 
 void thread3_main(UNUSED void *arg) {
     create_thread(&gSoundThread, 4, thread4_sound, NULL, gThread4Stack + 0x2000, 20);
@@ -338,7 +577,12 @@ void thread3_main(UNUSED void *arg) {
                 handle_dp_complete();
                 break;
             case MESG_START_GFX_SPTASK:
+#ifdef SPTASK_SCHEDULER
+                receive_new_tasks();
+                schedule_sptasks();
+#else
                 start_gfx_sptask();
+#endif
                 break;
         }
         CheckStackMemory();
@@ -364,7 +608,23 @@ void dispatch_audio_sptask(struct SPTask *spTask) {
     osSendMesg(&gSPTaskMesgQueue, spTask, OS_MESG_NOBLOCK);
 }
 
+#ifdef SPTASK_SCHEDULER
+/**
+ * Queue an SP task to run as soon as the scheduler allows, rather than on the next
+ * vblank. Its message is sent to its msgqueue once the RSP is done with it.
+ */
+void dispatch_sptask(struct SPTask *spTask) {
+    osWritebackDCacheAll();
+    spTask->state = SPTASK_STATE_NOT_STARTED;
+    osSendMesg(&gSPTaskMesgQueue, spTask, OS_MESG_NOBLOCK);
+    osSendMesg(&gIntrMesgQueue, (OSMesg) MESG_START_GFX_SPTASK, OS_MESG_NOBLOCK);
+}
+#endif
+
 void exec_display_list(struct SPTask *spTask) {
+#ifdef SPTASK_SCHEDULER
+    dispatch_sptask(spTask);
+#else
     osWritebackDCacheAll();
     spTask->state = SPTASK_STATE_NOT_STARTED;
     if (sCurrentDisplaySPTask == NULL) {
@@ -374,6 +634,7 @@ void exec_display_list(struct SPTask *spTask) {
     } else {
         sNextDisplaySPTask = spTask;
     }
+#endif
 }
 
 /**
@@ -27,6 +27,20 @@ extern struct VblankHandler *gVblankHandler1;
 extern struct VblankHandler *gVblankHandler2;
 extern struct SPTask *gActiveSPTask;
 extern u32 gNumVblanks;
+extern OSTime gVblankTimes[8];
+
+#ifdef SPTASK_SCHEDULER
+struct SPTaskStats {
+    /// Number of times a gfx task yielded to a task with a higher priority
+    u32 yields;
+    /// Total time from asking gfx tasks to yield until the RSP was free
+    OSTime yieldTime;
+    /// Number of tasks that were done after their deadline
+    u32 deadlineMisses;
+};
+
+extern struct SPTaskStats gSPTaskStats;
+#endif
 extern s8 gDebugLevelSelect;
 extern s8 D_8032C650;
 extern s8 gShowProfiler;
@@ -35,5 +49,8 @@ extern s8 gShowDebugText;
 void set_vblank_handler(s32 index, struct VblankHandler *handler, OSMesgQueue *queue, OSMesg *msg);
 void dispatch_audio_sptask(struct SPTask *spTask);
 void exec_display_list(struct SPTask *spTask);
+#ifdef SPTASK_SCHEDULER
+void dispatch_sptask(struct SPTask *spTask);
+#endif
 
 #endif // MAIN_H
@@ -540,6 +540,9 @@ void *alloc_display_list(u32 size) {
         ptr = gGfxPoolEnd;
     } else {
         rmonpf(("DYnamic memory overflow\n"));
+#ifdef GFX_POOL_PROFILER
+        gfx_pool_overflow();
+#endif
     }
     return ptr;
 }
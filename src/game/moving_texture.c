@@ -4,6 +4,7 @@
 #include "moving_texture.h"
 #include "area.h"
 #include "camera.h"
+#include "game_init.h"
 #include "rendering_graph_node.h"
 #include "engine/math_util.h"
 #include "memory.h"
@@ -188,6 +189,15 @@ Gfx *geo_movtex_pause_control(s32 callContext, UNUSED struct GraphNode *node, UN
     return NULL;
 }
 
+/**
+ * Set the texture coordinates of a vertex that's part of a quad with rotating texture.
+ * See movtex_make_quad_vertex for the parameters.
+ */
+void movtex_set_quad_tex_coords(Vtx *verts, s32 index, s16 rot, s16 rotOffset, f32 scale) {
+    verts[index].v.tc[0] = 32.0 * (32.0 * scale - 1.0) * sins(rot + rotOffset);
+    verts[index].v.tc[1] = 32.0 * (32.0 * scale - 1.0) * coss(rot + rotOffset);
+}
+
 /**
  * Make a vertex that's part of a quad with rotating texture.
  * verts: array of RSP vertices
@@ -199,16 +209,14 @@ Gfx *geo_movtex_pause_control(s32 callContext, UNUSED struct GraphNode *node, UN
  */
 void movtex_make_quad_vertex(Vtx *verts, s32 index, s16 x, s16 y, s16 z, s16 rot, s16 rotOffset,
                              f32 scale, u8 alpha) {
-    s16 s = 32.0 * (32.0 * scale - 1.0) * sins(rot + rotOffset);
-    s16 t = 32.0 * (32.0 * scale - 1.0) * coss(rot + rotOffset);
-
     if (gMovtexVtxColor == MOVTEX_VTX_COLOR_YELLOW) {
-        make_vertex(verts, index, x, y, z, s, t, 255, 255, 0, alpha);
+        make_vertex(verts, index, x, y, z, 0, 0, 255, 255, 0, alpha);
     } else if (gMovtexVtxColor == MOVTEX_VTX_COLOR_RED) {
-        make_vertex(verts, index, x, y, z, s, t, 255, 0, 0, alpha);
+        make_vertex(verts, index, x, y, z, 0, 0, 255, 0, 0, alpha);
     } else {
-        make_vertex(verts, index, x, y, z, s, t, 255, 255, 255, alpha);
+        make_vertex(verts, index, x, y, z, 0, 0, 255, 255, 255, alpha);
     }
+    movtex_set_quad_tex_coords(verts, index, rot, rotOffset, scale);
 }
 
 /**
@@ -240,12 +248,124 @@ struct MovtexQuad {
 /// Variable for a little optimization: only set the texture when it differs from the previous texture
 s16 gMovetexLastTextureId;
 
+#ifdef MOVTEX_RESIDENT_VTX
+/// Every moving texture mesh fits in the RSP's vertex buffer
+#define MOVTEX_MAX_VTX 16
+
 /**
- * Generates and returns a display list for a single MovtexQuad at height y.
+ * Moving texture vertices and display lists that are kept between frames, since
+ * only the texture coordinates of a mesh change from frame to frame. There are
+ * two buffers, which are used in turn: the RSP may still be reading the one that
+ * was used in the previous frame.
  */
-Gfx *movtex_gen_from_quad(s16 y, struct MovtexQuad *quad) {
-    s16 rot;
-    s16 rotspeed = quad->rotspeed;
+struct MovtexVtxBuffers {
+    const void *owner;
+    /// gGlobalTimer of the frame each buffer was last used in
+    u32 frame[2];
+    /// The height and vertex color each buffer was filled with
+    s16 y[2];
+    s8 color[2];
+    /// Whether each buffer holds vertices of the owner
+    s8 valid[2];
+    /// The buffer used this frame
+    s8 cur;
+    /// Whether the buffer used this frame only needs its texture coordinates updated
+    s8 filled;
+};
+
+struct MovtexQuadBuffers {
+    struct MovtexVtxBuffers bufs;
+    Vtx verts[2][4];
+    Gfx gfx[2][8];
+};
+
+struct MovtexListBuffers {
+    struct MovtexVtxBuffers bufs;
+    Vtx verts[2][MOVTEX_MAX_VTX];
+    Gfx gfx[2][11];
+};
+
+/**
+ * The buffers, allocated from the main pool for each level by alloc_movtex_buffers.
+ * Vertices are allocated from the display list pool every frame while they are NULL.
+ */
+static struct MovtexQuadBuffers *sMovtexQuadBuffers = NULL;
+static struct MovtexListBuffers *sMovtexListBuffers = NULL;
+
+/**
+ * Allocate empty buffers from the main pool. Called on level load after the pool
+ * state is pushed, so that the buffers are freed along with the level.
+ */
+void alloc_movtex_buffers(void) {
+    sMovtexQuadBuffers =
+        main_pool_alloc(MOVTEX_QUAD_BUFFERS * sizeof(struct MovtexQuadBuffers), MEMORY_POOL_LEFT);
+    if (sMovtexQuadBuffers != NULL) {
+        bzero(sMovtexQuadBuffers, MOVTEX_QUAD_BUFFERS * sizeof(struct MovtexQuadBuffers));
+    }
+    sMovtexListBuffers = main_pool_alloc(ARRAY_COUNT(gMovtexNonColored) * sizeof(struct MovtexListBuffers),
+                                         MEMORY_POOL_LEFT);
+    if (sMovtexListBuffers != NULL) {
+        bzero(sMovtexListBuffers, ARRAY_COUNT(gMovtexNonColored) * sizeof(struct MovtexListBuffers));
+    }
+}
+
+/**
+ * Stop using the buffers before the level's memory is freed.
+ */
+void free_movtex_buffers(void) {
+    sMovtexQuadBuffers = NULL;
+    sMovtexListBuffers = NULL;
+}
+
+/**
+ * Select the buffer 'owner' writes its vertices to this frame, or return -1
+ * if both buffers may still be in use and they have to be allocated instead.
+ */
+static s32 movtex_select_buffer(struct MovtexVtxBuffers *bufs, const void *owner, s16 y, s8 color) {
+    s32 next = bufs->cur ^ 1;
+
+    if (bufs->owner != owner) {
+        // The frames are kept, the RSP may still read the buffers of the previous owner
+        bufs->owner = owner;
+        bufs->valid[0] = FALSE;
+        bufs->valid[1] = FALSE;
+    }
+    if (gGlobalTimer - bufs->frame[next] < 2) {
+        return -1;
+    }
+
+    bufs->filled = bufs->valid[next] && bufs->y[next] == y && bufs->color[next] == color;
+    bufs->cur = next;
+    bufs->frame[next] = gGlobalTimer;
+    bufs->y[next] = y;
+    bufs->color[next] = color;
+    bufs->valid[next] = TRUE;
+    return next;
+}
+
+/**
+ * Set the texture coordinates of a MovtexQuad's vertices for its current rotation.
+ */
+static void movtex_update_quad_tex_coords(Vtx *verts, struct MovtexQuad *quad) {
+    if (quad->rotDir == ROTATE_CLOCKWISE) {
+        movtex_set_quad_tex_coords(verts, 0, quad->rot, 0, quad->scale);
+        movtex_set_quad_tex_coords(verts, 1, quad->rot, 16384, quad->scale);
+        movtex_set_quad_tex_coords(verts, 2, quad->rot, -32768, quad->scale);
+        movtex_set_quad_tex_coords(verts, 3, quad->rot, -16384, quad->scale);
+    } else { // ROTATE_COUNTER_CLOCKWISE
+        movtex_set_quad_tex_coords(verts, 0, quad->rot, 0, quad->scale);
+        movtex_set_quad_tex_coords(verts, 1, quad->rot, -16384, quad->scale);
+        movtex_set_quad_tex_coords(verts, 2, quad->rot, -32768, quad->scale);
+        movtex_set_quad_tex_coords(verts, 3, quad->rot, 16384, quad->scale);
+    }
+}
+#endif
+
+/**
+ * Makes the vertices of a MovtexQuad at height y.
+ */
+static void movtex_make_quad_verts(Vtx *verts, s16 y, struct MovtexQuad *quad) {
+    s16 rot = quad->rot;
     s16 scale = quad->scale;
     s16 x1 = quad->x1;
     s16 z1 = quad->z1;
@@ -257,25 +377,7 @@ Gfx *movtex_gen_from_quad(s16 y, struct MovtexQuad *quad) {
     s16 z4 = quad->z4;
     s16 rotDir = quad->rotDir;
     s16 alpha = quad->alpha;
-    s16 textureId = quad->textureId;
-    Vtx *verts = alloc_display_list(4 * sizeof(*verts));
-    Gfx *gfxHead;
-    Gfx *gfx;
-
-    if (textureId == gMovetexLastTextureId) {
-        gfxHead = alloc_display_list(3 * sizeof(*gfxHead));
-    } else {
-        gfxHead = alloc_display_list(8 * sizeof(*gfxHead));
-    }
 
-    if (gfxHead == NULL || verts == NULL) {
-        return NULL;
-    }
-    gfx = gfxHead;
-    if (gMovtexCounter != gMovtexCounterPrev) {
-        quad->rot += rotspeed;
-    }
-    rot = quad->rot;
     if (rotDir == ROTATE_CLOCKWISE) {
         movtex_make_quad_vertex(verts, 0, x1, y, z1, rot, 0, scale, alpha);
         movtex_make_quad_vertex(verts, 1, x2, y, z2, rot, 16384, scale, alpha);
@@ -287,6 +389,56 @@ Gfx *movtex_gen_from_quad(s16 y, struct MovtexQuad *quad) {
         movtex_make_quad_vertex(verts, 2, x3, y, z3, rot, -32768, scale, alpha);
         movtex_make_quad_vertex(verts, 3, x4, y, z4, rot, 16384, scale, alpha);
     }
+}
+
+/**
+ * Generates and returns a display list for a single MovtexQuad at height y.
+ */
+Gfx *movtex_gen_from_quad(s16 y, struct MovtexQuad *quad) {
+    s16 textureId = quad->textureId;
+    Vtx *verts = NULL;
+    Gfx *gfxHead = NULL;
+    Gfx *gfx;
+#ifdef MOVTEX_RESIDENT_VTX
+    struct MovtexQuadBuffers *resident = NULL;
+    s32 buffer = -1;
+
+    if (sMovtexQuadBuffers != NULL) {
+        resident =
+            &sMovtexQuadBuffers[((((u32) quad >> 1) * 0x9E3779B1) >> 16) & (MOVTEX_QUAD_BUFFERS - 1)];
+        buffer = movtex_select_buffer(&resident->bufs, quad, y, gMovtexVtxColor);
+    }
+    if (buffer >= 0) {
+        verts = resident->verts[buffer];
+        gfxHead = resident->gfx[buffer];
+    }
+#endif
+
+    if (verts == NULL) {
+        verts = alloc_display_list(4 * sizeof(*verts));
+        if (textureId == gMovetexLastTextureId) {
+            gfxHead = alloc_display_list(3 * sizeof(*gfxHead));
+        } else {
+            gfxHead = alloc_display_list(8 * sizeof(*gfxHead));
+        }
+    }
+
+    if (gfxHead == NULL || verts == NULL) {
+        return NULL;
+    }
+    gfx = gfxHead;
+    if (gMovtexCounter != gMovtexCounterPrev) {
+        quad->rot += quad->rotspeed;
+    }
+#ifdef MOVTEX_RESIDENT_VTX
+    if (buffer >= 0 && resident->bufs.filled) {
+        movtex_update_quad_tex_coords(verts, quad);
+    } else {
+        movtex_make_quad_verts(verts, y, quad);
+    }
+#else
+    movtex_make_quad_verts(verts, y, quad);
+#endif
 
     // Only add commands to change the texture when necessary
     if (textureId != gMovetexLastTextureId) {
@@ -564,24 +716,81 @@ void movtex_write_vertex_index(Vtx *verts, s32 index, s16 *movtexVerts, struct M
     }
 }
 
+#ifdef MOVTEX_RESIDENT_VTX
+/**
+ * Update only the texture coordinates of vertices made by movtex_write_vertex_first and
+ * movtex_write_vertex_index, after the texture offset of the first vertex changed.
+ */
+static void movtex_update_list_tex_coords(Vtx *verts, s16 *movtexVerts, s32 vtxCount, s8 attrLayout) {
+    s32 stride = attrLayout == MOVTEX_LAYOUT_COLORED ? 8 : 5;
+    s32 attrS = attrLayout == MOVTEX_LAYOUT_COLORED ? MOVTEX_ATTR_COLORED_S : MOVTEX_ATTR_NOCOLOR_S;
+    s16 baseS = movtexVerts[attrS];
+    s16 baseT = movtexVerts[attrS + 1];
+    s16 offS;
+    s16 offT;
+    s32 i;
+
+    verts[0].v.tc[0] = baseS;
+    verts[0].v.tc[1] = baseT;
+    for (i = 1; i < vtxCount; i++) {
+        offS = movtexVerts[i * stride + attrS];
+        offT = movtexVerts[i * stride + attrS + 1];
+        verts[i].v.tc[0] = (s16) (baseS + ((offS * 32) * 32U));
+        verts[i].v.tc[1] = (s16) (baseT + ((offT * 32) * 32U));
+    }
+}
+#endif
+
 /**
  * Generate a displaylist for a MovtexObject.
  * 'attrLayout' is one of MOVTEX_LAYOUT_NOCOLOR and MOVTEX_LAYOUT_COLORED.
  */
 Gfx *movtex_gen_list(s16 *movtexVerts, struct MovtexObject *movtexList, s8 attrLayout) {
-    Vtx *verts = alloc_display_list(movtexList->vtx_count * sizeof(*verts));
-    Gfx *gfxHead = alloc_display_list(11 * sizeof(*gfxHead));
-    Gfx *gfx = gfxHead;
+    Vtx *verts = NULL;
+    Gfx *gfxHead = NULL;
+    Gfx *gfx;
     s32 i;
+#ifdef MOVTEX_RESIDENT_VTX
+    struct MovtexListBuffers *resident = NULL;
+    s32 buffer = -1;
+
+    i = movtexList - gMovtexNonColored;
+    if (sMovtexListBuffers != NULL && i >= 0 && i < ARRAY_COUNT(gMovtexNonColored)
+        && movtexList->vtx_count <= MOVTEX_MAX_VTX) {
+        resident = &sMovtexListBuffers[i];
+        buffer = movtex_select_buffer(&resident->bufs, movtexList, 0, attrLayout);
+    }
+    if (buffer >= 0) {
+        verts = resident->verts[buffer];
+        gfxHead = resident->gfx[buffer];
+    }
+#endif
+
+    if (verts == NULL) {
+        verts = alloc_display_list(movtexList->vtx_count * sizeof(*verts));
+        gfxHead = alloc_display_list(11 * sizeof(*gfxHead));
+    }
+    gfx = gfxHead;
 
     if (verts == NULL || gfxHead == NULL) {
         return NULL;
     }
 
+#ifdef MOVTEX_RESIDENT_VTX
+    if (buffer >= 0 && resident->bufs.filled) {
+        movtex_update_list_tex_coords(verts, movtexVerts, movtexList->vtx_count, attrLayout);
+    } else {
+        movtex_write_vertex_first(verts, movtexVerts, movtexList, attrLayout);
+        for (i = 1; i < movtexList->vtx_count; i++) {
+            movtex_write_vertex_index(verts, i, movtexVerts, movtexList, attrLayout);
+        }
+    }
+#else
     movtex_write_vertex_first(verts, movtexVerts, movtexList, attrLayout);
     for (i = 1; i < movtexList->vtx_count; i++) {
         movtex_write_vertex_index(verts, i, movtexVerts, movtexList, attrLayout);
     }
+#endif
 
     gSPDisplayList(gfx++, movtexList->beginDl);
     gLoadBlockTexture(gfx++, 32, 32, G_IM_FMT_RGBA, gMovtexIdToTexture[movtexList->textureId]);
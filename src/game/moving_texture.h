@@ -119,5 +119,9 @@ Gfx *geo_movtex_draw_colored_no_update(s32 callContext, struct GraphNode *node,
 Gfx *geo_movtex_draw_colored_2_no_update(s32 callContext, struct GraphNode *node, UNUSED Mat4 mtx);
 Gfx *geo_movtex_update_horizontal(s32 callContext, struct GraphNode *node, UNUSED Mat4 mtx);
 Gfx *geo_movtex_draw_colored_no_update(s32 callContext, struct GraphNode *node, UNUSED Mat4 mtx);
+#ifdef MOVTEX_RESIDENT_VTX
+void alloc_movtex_buffers(void);
+void free_movtex_buffers(void);
+#endif
 
 #endif // MOVING_TEXTURE_H
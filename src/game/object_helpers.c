@@ -23,6 +23,7 @@
 #include "obj_behaviors.h"
 #include "object_helpers.h"
 #include "object_list_processor.h"
+#include "particle_system.h"
 #include "rendering_graph_node.h"
 #include "spawn_object.h"
 #include "spawn_sound.h"
@@ -2064,38 +2065,46 @@ s16 cur_obj_reflect_move_angle_off_wall(void) {
     return angle;
 }
 
+/**
+ * Spawn a burst of white puff particles around the current object. These used
+ * to be bhvWhitePuffExplosion objects and are now lightweight particles, so
+ * they no longer compete with other objects for slots.
+ */
 void cur_obj_spawn_particles(struct SpawnParticlesInfo *info) {
-    struct Object *particle;
+    s32 particle;
     s32 i;
     f32 scale;
     s32 numParticles = info->count;
 
-    // If there are a lot of objects already, limit the number of particles
-    if ((gPrevFrameObjectCount > (OBJECT_POOL_CAPACITY - 90)) && numParticles > 10) {
-        numParticles = 10;
-    }
-
-    // We're close to running out of object slots, so don't spawn particles at
-    // all
-    if (gPrevFrameObjectCount > (OBJECT_POOL_CAPACITY - 30)) {
-        numParticles = 0;
-    }
-
     for (i = 0; i < numParticles; i++) {
         scale = random_float() * (info->sizeRange * 0.1f) + info->sizeBase * 0.1f;
 
-        particle = spawn_object(o, info->model, bhvWhitePuffExplosion);
-
-        particle->oBhvParams2ndByte = info->bhvParam;
-        particle->oMoveAngleYaw = random_u16();
-        particle->oGravity = info->gravity;
-        particle->oDragStrength = info->dragStrength;
-
-        particle->oPosY += info->offsetY;
-        particle->oForwardVel = random_float() * info->forwardVelRange + info->forwardVelBase;
-        particle->oVelY = random_float() * info->velYRange + info->velYBase;
+        particle = spawn_particle_at(info->model, o->oPosX, o->oPosY + info->offsetY, o->oPosZ, 21,
+                                     PARTICLE_FLAG_BILLBOARD);
+        if (particle < 0) {
+            break;
+        }
 
-        obj_scale_xyz(particle, scale, scale, scale);
+        particle_set_forward_vel(particle, random_u16(),
+                                 random_float() * info->forwardVelRange + info->forwardVelBase);
+        gParticles->velY[particle] = random_float() * info->velYRange + info->velYBase;
+        gParticles->maxVelY[particle] = 100.0f;
+        gParticles->gravity[particle] = info->gravity;
+        gParticles->dragStrength[particle] = info->dragStrength;
+        gParticles->scale[particle] = scale;
+
+        switch (info->bhvParam) {
+            case 2:
+                gParticles->alpha[particle] = 254;
+                gParticles->alphaVel[particle] = -21;
+                gParticles->flags[particle] |= PARTICLE_FLAG_FADE | PARTICLE_FLAG_SCALE_WITH_ALPHA;
+                break;
+            case 3:
+                gParticles->alpha[particle] = 254;
+                gParticles->alphaVel[particle] = -13;
+                gParticles->flags[particle] |= PARTICLE_FLAG_FADE | PARTICLE_FLAG_GROW_WITH_ALPHA;
+                break;
+        }
     }
 }
 
@@ -2104,6 +2113,7 @@ void obj_set_hitbox(struct Object *obj, struct ObjectHitbox *hitbox) {
         obj->oFlags |= OBJ_FLAG_30;
 
         obj->oInteractType = hitbox->interactType;
+        obj_update_time_stop_exemption(obj);
         obj->oDamageOrCoinValue = hitbox->damageOrCoinValue;
         obj->oHealth = hitbox->health;
         obj->oNumLootCoins = hitbox->numLootCoins;
@@ -2565,6 +2575,7 @@ s32 cur_obj_update_dialog(s32 actionArg, s32 dialogFlags, s32 dialogID, UNUSED s
             if (gMarioState->health >= 0x100) {
                 gTimeStopState |= TIME_STOP_ENABLED;
                 o->activeFlags |= ACTIVE_FLAG_INITIATED_TIME_STOP;
+                obj_update_time_stop_exemption(o);
                 o->oDialogState++;
             }
             break;
@@ -2611,6 +2622,7 @@ s32 cur_obj_update_dialog(s32 actionArg, s32 dialogFlags, s32 dialogID, UNUSED s
                 || (dialogFlags & DIALOG_FLAG_TIME_STOP_ENABLED)) {
                 gTimeStopState &= ~TIME_STOP_ENABLED;
                 o->activeFlags &= ~ACTIVE_FLAG_INITIATED_TIME_STOP;
+                obj_update_time_stop_exemption(o);
                 dialogResponse = o->oDialogResponse;
                 o->oDialogState = DIALOG_STATUS_ENABLE_TIME_STOP;
             }
@@ -2637,6 +2649,7 @@ s32 cur_obj_update_dialog_with_cutscene(s32 actionArg, s32 dialogFlags, s32 cuts
             if (gMarioState->health >= 0x0100) {
                 gTimeStopState |= TIME_STOP_ENABLED;
                 o->activeFlags |= ACTIVE_FLAG_INITIATED_TIME_STOP;
+                obj_update_time_stop_exemption(o);
                 o->oDialogState++;
                 o->oDialogResponse = DIALOG_RESPONSE_NONE;
             }
@@ -2677,6 +2690,7 @@ s32 cur_obj_update_dialog_with_cutscene(s32 actionArg, s32 dialogFlags, s32 cuts
                 // until the set_mario_npc_dialog function disables it
                 gTimeStopState &= ~TIME_STOP_ENABLED;
                 o->activeFlags &= ~ACTIVE_FLAG_INITIATED_TIME_STOP;
+                obj_update_time_stop_exemption(o);
                 dialogResponse = o->oDialogResponse;
                 o->oDialogState = DIALOG_STATUS_ENABLE_TIME_STOP;
             } else {
@@ -2827,11 +2841,13 @@ void cur_obj_unused_play_footstep_sound(s32 animFrame1, s32 animFrame2, s32 soun
 void enable_time_stop_including_mario(void) {
     gTimeStopState |= TIME_STOP_ENABLED | TIME_STOP_MARIO_AND_DOORS;
     o->activeFlags |= ACTIVE_FLAG_INITIATED_TIME_STOP;
+    obj_update_time_stop_exemption(o);
 }
 
 void disable_time_stop_including_mario(void) {
     gTimeStopState &= ~(TIME_STOP_ENABLED | TIME_STOP_MARIO_AND_DOORS);
     o->activeFlags &= ~ACTIVE_FLAG_INITIATED_TIME_STOP;
+    obj_update_time_stop_exemption(o);
 }
 
 s32 cur_obj_check_interacted(void) {
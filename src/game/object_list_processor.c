@@ -3,6 +3,7 @@
 #include "sm64.h"
 #include "area.h"
 #include "behavior_data.h"
+#include "behavior_profiler.h"
 #include "camera.h"
 #include "debug.h"
 #include "engine/behavior_script.h"
@@ -10,12 +11,14 @@
 #include "engine/surface_collision.h"
 #include "engine/surface_load.h"
 #include "interaction.h"
+#include "level_table.h"
 #include "level_update.h"
 #include "mario.h"
 #include "memory.h"
 #include "object_collision.h"
 #include "object_helpers.h"
 #include "object_list_processor.h"
+#include "particle_system.h"
 #include "platform_displacement.h"
 #include "profiler.h"
 #include "spawn_object.h"
@@ -67,6 +70,24 @@ u32 gTimeStopState;
  */
 struct Object gObjectPool[OBJECT_POOL_CAPACITY];
 
+/**
+ * A second slab of object slots, allocated from the main pool when a level
+ * that reserves extra slots is loaded. NULL if the level reserves none.
+ */
+struct Object *gObjectSlab2;
+
+/**
+ * The number of slots in gObjectSlab2.
+ */
+s32 gObjectSlab2Capacity;
+
+/**
+ * The total number of object slots available in the current level, i.e.
+ * OBJECT_POOL_CAPACITY plus the size of the second slab. Code that throttles
+ * itself based on how full the pool is should compare against this.
+ */
+s32 gObjectPoolCapacity = OBJECT_POOL_CAPACITY;
+
 /**
  * A special object whose purpose is to act as a parent for macro objects.
  */
@@ -213,6 +234,151 @@ struct ParticleProperties sParticleTypes[] = {
     { 0, 0, MODEL_NONE, NULL },
 };
 
+#ifdef OBJECT_POOL_RESERVATIONS
+/**
+ * The number of extra object slots a level reserves on top of
+ * OBJECT_POOL_CAPACITY.
+ */
+struct ObjectPoolReservation {
+    s16 levelNum;
+    s16 numSlots;
+};
+
+/**
+ * A table of per-level object slot reservations, terminated by LEVEL_NONE.
+ * Levels that are not listed only get the static object pool.
+ */
+struct ObjectPoolReservation sObjectPoolReservations[] = {
+    { LEVEL_NONE, 0 },
+};
+
+/**
+ * Return the number of extra object slots reserved by the given level.
+ */
+static s32 get_object_pool_reservation(s32 levelNum) {
+    struct ObjectPoolReservation *reservation = sObjectPoolReservations;
+
+    while (reservation->levelNum != LEVEL_NONE) {
+        if (reservation->levelNum == levelNum) {
+            return reservation->numSlots;
+        }
+        reservation++;
+    }
+
+    return 0;
+}
+#endif
+
+#ifdef OBJECT_SLEEP_SCHEDULING
+/**
+ * Opt-in sleep scheduling for a behavior. While Mario is farther away than
+ * wakeDistance, the object is asleep: it ticks once every tickInterval frames,
+ * or not at all if tickInterval is 0.
+ */
+struct ObjectSleepRule {
+    const BehaviorScript *behavior;
+    f32 wakeDistance;
+    s16 tickInterval;
+};
+
+/**
+ * The behaviors that may sleep, terminated by NULL. Objects with collision
+ * models never sleep, since their surfaces are reloaded each time they tick.
+ * Objects that must keep moving to despawn, like birds, must not be listed
+ * with a tick interval of 0.
+ */
+struct ObjectSleepRule sObjectSleepRules[] = {
+    { bhvFish, 4000.0f, 4 },
+    { bhvSmallBully, 4000.0f, 2 },
+    { bhvPiranhaPlant, 3000.0f, 0 },
+    { NULL, 0.0f, 0 },
+};
+#endif
+
+/**
+ * Return the sleep rule for an object with the given behavior (at its virtual
+ * address), to be stored in the object's sleepRule field.
+ */
+s16 get_object_sleep_rule(UNUSED const BehaviorScript *behavior) {
+#ifdef OBJECT_SLEEP_SCHEDULING
+    s32 i;
+
+    for (i = 0; sObjectSleepRules[i].behavior != NULL; i++) {
+        if (segmented_to_virtual(sObjectSleepRules[i].behavior) == behavior) {
+            return i + 1;
+        }
+    }
+#endif
+
+    return 0;
+}
+
+#ifdef OBJECT_SLEEP_SCHEDULING
+/**
+ * Wake an object from sleep. The object's timer is advanced by the number of
+ * frames it skipped, so that timer-driven actions resume in step with the
+ * time that has passed. Delays in the behavior script, animations and motion
+ * are not caught up; they continue from where the object stopped.
+ */
+static void obj_catch_up_sleep_frames(struct Object *obj) {
+    obj->oTimer += obj->sleepFrames;
+    if (obj->oTimer > 0x3FFFFFFF) {
+        obj->oTimer = 0x3FFFFFFF;
+    }
+    obj->sleepFrames = 0;
+}
+
+/**
+ * Return whether an object should be updated this frame under its sleep rule.
+ * An object is awake until it has ticked once, so that its behavior's init
+ * commands always run. After that, it is awake while Mario is within the
+ * rule's wake distance, while it is interacting or colliding with something,
+ * while it is held, or while its parent is an awake object with a sleep rule
+ * of its own. Sleeping objects are
+ * marked ACTIVE_FLAG_FAR_AWAY so that movement helpers take their cheaper
+ * far-away paths on the frames they do tick.
+ */
+static s32 obj_is_due_for_update(struct Object *obj) {
+    struct ObjectSleepRule *rule;
+    struct Object *parent = obj->parentObj;
+    f32 dx, dy, dz;
+
+    if (obj->sleepRule == 0 || obj->collisionData != NULL || gMarioObject == NULL
+        || obj->curBhvCommand == obj->behavior) {
+        return TRUE;
+    }
+
+    rule = &sObjectSleepRules[obj->sleepRule - 1];
+    dx = obj->oPosX - gMarioObject->oPosX;
+    dy = obj->oPosY - gMarioObject->oPosY;
+    dz = obj->oPosZ - gMarioObject->oPosZ;
+
+    if (dx * dx + dy * dy + dz * dz < rule->wakeDistance * rule->wakeDistance
+        || obj->oInteractStatus != 0 || obj->numCollidedObjs != 0 || obj->oHeldState != HELD_FREE
+        || (parent != obj && parent->sleepRule != 0 && !(parent->activeFlags & ACTIVE_FLAG_SLEEPING))) {
+        if (obj->activeFlags & ACTIVE_FLAG_SLEEPING) {
+            obj->activeFlags &= ~(ACTIVE_FLAG_SLEEPING | ACTIVE_FLAG_FAR_AWAY);
+            obj_catch_up_sleep_frames(obj);
+        }
+        return TRUE;
+    }
+
+    obj->activeFlags |= ACTIVE_FLAG_SLEEPING | ACTIVE_FLAG_FAR_AWAY;
+
+    if (rule->tickInterval != 0 && obj->sleepFrames + 1 >= rule->tickInterval) {
+        obj_catch_up_sleep_frames(obj);
+        return TRUE;
+    }
+
+    // Objects that never tick while asleep can sleep for longer than the
+    // counter can hold; their timer catches up by at most 0x7FFF frames
+    if (obj->sleepFrames < 0x7FFF) {
+        obj->sleepFrames++;
+    }
+    return FALSE;
+}
+#endif
+
 /**
  * Copy position, velocity, and angle variables from MarioState to the Mario
  * object.
@@ -245,6 +411,99 @@ void copy_mario_state_to_object(void) {
     gCurrentObject->oAngleVelRoll = gMarioStates[i].angleVel[2];
 }
 
+#ifdef TIME_STOP_EXEMPT_LIST
+// The maximum number of objects tracked in the time stop exempt subset.
+#define TIME_STOP_EXEMPT_CAPACITY 32
+
+/**
+ * Objects outside the unimportant list that may keep updating while time is
+ * stopped: doors and objects that initiated time stop. Mario is checked
+ * directly, and the unimportant list is always walked in full. Entries are
+ * kept in the order they were added, along with the list each object is in.
+ */
+static struct Object *sTimeStopExemptObjs[TIME_STOP_EXEMPT_CAPACITY];
+static struct ObjectNode *sTimeStopExemptObjLists[TIME_STOP_EXEMPT_CAPACITY];
+static s32 sNumTimeStopExemptObjs;
+
+/**
+ * Whether the next stopped frame must walk every object list, as it did before
+ * the exempt subset existed. This is needed on the first stopped frame, to
+ * freeze the animations of every object outside the subset, and after objects
+ * are spawned while time is stopped.
+ */
+static s8 sTimeStopFullWalkRequested;
+
+/**
+ * Whether the current frame walks every object list.
+ */
+static s8 sTimeStopFullWalk;
+
+/**
+ * The number of objects in each list as of the last full walk. Objects are not
+ * spawned while time is stopped without forcing a new full walk, so these are
+ * used for gObjectCounter on frames that only visit the exempt subset.
+ */
+static s16 sTimeStopListCounts[NUM_OBJ_LISTS];
+#endif
+
+/**
+ * Add the object to, or remove it from, the set of objects visited on stopped
+ * frames, based on its interaction type and active flags. Must be called
+ * whenever either of these may have changed whether the object is a door or
+ * initiated time stop.
+ */
+void obj_update_time_stop_exemption(UNUSED struct Object *obj) {
+#ifdef TIME_STOP_EXEMPT_LIST
+    s32 exempt = FALSE;
+    s32 i;
+
+    if ((obj->activeFlags & ACTIVE_FLAG_ACTIVE) && !(obj->activeFlags & ACTIVE_FLAG_UNIMPORTANT)) {
+        if ((obj->oInteractType & (INTERACT_DOOR | INTERACT_WARP_DOOR))
+            || (obj->activeFlags & ACTIVE_FLAG_INITIATED_TIME_STOP)) {
+            exempt = TRUE;
+        }
+    }
+
+    for (i = 0; i < sNumTimeStopExemptObjs; i++) {
+        if (sTimeStopExemptObjs[i] == obj) {
+            break;
+        }
+    }
+
+    if (exempt && i == sNumTimeStopExemptObjs) {
+        if (sNumTimeStopExemptObjs < TIME_STOP_EXEMPT_CAPACITY) {
+            sTimeStopExemptObjs[i] = obj;
+            sTimeStopExemptObjLists[i] = &gObjectLists[get_object_list_from_behavior(obj->behavior)];
+            sNumTimeStopExemptObjs++;
+        } else {
+            // Can't track it, so fall back to walking every object
+            sTimeStopFullWalkRequested = TRUE;
+        }
+    } else if (!exempt && i < sNumTimeStopExemptObjs) {
+        sNumTimeStopExemptObjs--;
+        for (; i < sNumTimeStopExemptObjs; i++) {
+            sTimeStopExemptObjs[i] = sTimeStopExemptObjs[i + 1];
+            sTimeStopExemptObjLists[i] = sTimeStopExemptObjLists[i + 1];
+        }
+
+        // The object is no longer visited, so freeze its animation here
+        if (gTimeStopState & TIME_STOP_ACTIVE) {
+            obj->header.gfx.node.flags &= ~GRAPH_RENDER_HAS_ANIMATION;
+        }
+    }
+#endif
+}
+
+/**
+ * Make the next stopped frame walk every object list. Called when an object is
+ * spawned while time is stopped.
+ */
+void request_time_stop_full_walk(void) {
+#ifdef TIME_STOP_EXEMPT_LIST
+    sTimeStopFullWalkRequested = TRUE;
+#endif
+}
+
 /**
  * Spawn a particle at gCurrentObject's location.
  */
@@ -282,9 +541,25 @@ void bhv_mario_update(void) {
     }
 }
 
+/**
+ * Update the current object, timing the update if the behavior profiler is on.
+ */
+static void update_current_object(void) {
+#ifdef BEHAVIOR_PROFILER
+    if (gBehaviorProfilerEnabled) {
+        profile_cur_obj_update();
+        return;
+    }
+#endif
+
+    cur_obj_update();
+}
+
 /**
  * Update every object that occurs after firstObj in the given object list,
- * including firstObj itself. Return the number of objects that were updated.
+ * including firstObj itself. Objects that are asleep and not due for a tick
+ * are skipped, with their animation frozen. Return the number of objects in
+ * the list.
  */
 s32 update_objects_starting_at(struct ObjectNode *objList, struct ObjectNode *firstObj) {
     s32 count = 0;
@@ -292,8 +567,17 @@ s32 update_objects_starting_at(struct ObjectNode *objList, struct ObjectNode *fi
     while (objList != firstObj) {
         gCurrentObject = (struct Object *) firstObj;
 
+#ifdef OBJECT_SLEEP_SCHEDULING
+        if (!obj_is_due_for_update(gCurrentObject)) {
+            gCurrentObject->header.gfx.node.flags &= ~GRAPH_RENDER_HAS_ANIMATION;
+            firstObj = firstObj->next;
+            count++;
+            continue;
+        }
+#endif
+
         gCurrentObject->header.gfx.node.flags |= GRAPH_RENDER_HAS_ANIMATION;
-        cur_obj_update();
+        update_current_object();
 
         firstObj = firstObj->next;
         count++;
@@ -303,54 +587,99 @@ s32 update_objects_starting_at(struct ObjectNode *objList, struct ObjectNode *fi
 }
 
 /**
- * Update objects in objList starting with firstObj while time stop is active.
+ * Return whether the object should keep updating while time stop is active.
  * This means that only certain select objects will be updated, such as Mario,
  * doors, unimportant objects, and the object that initiated time stop.
  * The exact set of objects that are updated depends on which flags are set
  * in gTimeStopState.
+ */
+static s32 obj_is_unfrozen_during_time_stop(struct Object *obj) {
+    s32 unfrozen = FALSE;
+
+    // Selectively unfreeze certain objects
+    if (!(gTimeStopState & TIME_STOP_ALL_OBJECTS)) {
+        if (obj == gMarioObject && !(gTimeStopState & TIME_STOP_MARIO_AND_DOORS)) {
+            unfrozen = TRUE;
+        }
+
+        if ((obj->oInteractType & (INTERACT_DOOR | INTERACT_WARP_DOOR))
+            && !(gTimeStopState & TIME_STOP_MARIO_AND_DOORS)) {
+            unfrozen = TRUE;
+        }
+
+        if (obj->activeFlags & (ACTIVE_FLAG_UNIMPORTANT | ACTIVE_FLAG_INITIATED_TIME_STOP)) {
+            unfrozen = TRUE;
+        }
+    }
+
+    return unfrozen;
+}
+
+/**
+ * Update gCurrentObject while time stop is active if it is unfrozen, and
+ * otherwise freeze its animation.
+ */
+static void update_cur_obj_during_time_stop(void) {
+    if (obj_is_unfrozen_during_time_stop(gCurrentObject)) {
+        gCurrentObject->header.gfx.node.flags |= GRAPH_RENDER_HAS_ANIMATION;
+        update_current_object();
+    } else {
+        gCurrentObject->header.gfx.node.flags &= ~GRAPH_RENDER_HAS_ANIMATION;
+    }
+}
+
+/**
+ * Update objects in objList starting with firstObj while time stop is active,
+ * visiting every object in the list.
  * Return the total number of objects in the list (including those that weren't
  * updated)
  */
 s32 update_objects_during_time_stop(struct ObjectNode *objList, struct ObjectNode *firstObj) {
     s32 count = 0;
-    s32 unfrozen;
 
     while (objList != firstObj) {
         gCurrentObject = (struct Object *) firstObj;
 
-        unfrozen = FALSE;
+        update_cur_obj_during_time_stop();
 
-        // Selectively unfreeze certain objects
-        if (!(gTimeStopState & TIME_STOP_ALL_OBJECTS)) {
-            if (gCurrentObject == gMarioObject && !(gTimeStopState & TIME_STOP_MARIO_AND_DOORS)) {
-                unfrozen = TRUE;
-            }
+        firstObj = firstObj->next;
+        count++;
+    }
 
-            if ((gCurrentObject->oInteractType & (INTERACT_DOOR | INTERACT_WARP_DOOR))
-                && !(gTimeStopState & TIME_STOP_MARIO_AND_DOORS)) {
-                unfrozen = TRUE;
-            }
+    return count;
+}
 
-            if (gCurrentObject->activeFlags
-                & (ACTIVE_FLAG_UNIMPORTANT | ACTIVE_FLAG_INITIATED_TIME_STOP)) {
-                unfrozen = TRUE;
-            }
-        }
+#ifdef TIME_STOP_EXEMPT_LIST
+/**
+ * Update the objects in objList that may be unfrozen while time stop is
+ * active, without walking the rest of the list. Frozen objects already had
+ * their animation stopped by an earlier full walk. Return the number of
+ * objects in the list as of that walk.
+ */
+static s32 update_exempt_objects_during_time_stop(struct ObjectNode *objList) {
+    s32 i;
 
-        // Only update if unfrozen
-        if (unfrozen) {
-            gCurrentObject->header.gfx.node.flags |= GRAPH_RENDER_HAS_ANIMATION;
-            cur_obj_update();
-        } else {
-            gCurrentObject->header.gfx.node.flags &= ~GRAPH_RENDER_HAS_ANIMATION;
-        }
+    if (gMarioObject != NULL && objList == &gObjectLists[OBJ_LIST_PLAYER]) {
+        gCurrentObject = gMarioObject;
+        update_cur_obj_during_time_stop();
+    }
 
-        firstObj = firstObj->next;
-        count++;
+    // Objects may leave the subset while updating, which shifts the entries
+    // after them down by one
+    for (i = 0; i < sNumTimeStopExemptObjs; i++) {
+        if (sTimeStopExemptObjLists[i] == objList && sTimeStopExemptObjs[i] != gMarioObject) {
+            gCurrentObject = sTimeStopExemptObjs[i];
+            update_cur_obj_during_time_stop();
+
+            if (i >= sNumTimeStopExemptObjs || gCurrentObject != sTimeStopExemptObjs[i]) {
+                i--;
+            }
+        }
     }
 
-    return count;
+    return sTimeStopListCounts[objList - gObjectLists];
 }
+#endif
 
 /**
  * Update every object in the given list. Return the total number of objects in
@@ -363,7 +692,17 @@ s32 update_objects_in_list(struct ObjectNode *objList) {
     if (!(gTimeStopState & TIME_STOP_ACTIVE)) {
         count = update_objects_starting_at(objList, firstObj);
     } else {
+#ifdef TIME_STOP_EXEMPT_LIST
+        if (!sTimeStopFullWalk && !sTimeStopFullWalkRequested
+            && objList != &gObjectLists[OBJ_LIST_UNIMPORTANT]) {
+            count = update_exempt_objects_during_time_stop(objList);
+        } else {
+            count = update_objects_during_time_stop(objList, firstObj);
+            sTimeStopListCounts[objList - gObjectLists] = count;
+        }
+#else
         count = update_objects_during_time_stop(objList, firstObj);
+#endif
     }
 
     return count;
@@ -453,6 +792,8 @@ void spawn_objects_from_info(UNUSED s32 unused, struct SpawnInfo *spawnInfo) {
     gWDWWaterLevelChanging = FALSE;
     gMarioOnMerryGoRound = FALSE;
 
+    begin_object_spawn_batch();
+
     while (spawnInfo != NULL) {
         struct Object *object;
         UNUSED u8 filler[4];
@@ -474,7 +815,7 @@ void spawn_objects_from_info(UNUSED s32 unused, struct SpawnInfo *spawnInfo) {
             object->oBhvParams2ndByte = ((spawnInfo->behaviorArg) >> 16) & 0xFF;
 
             object->behavior = script;
-            object->unused1 = 0;
+            object->sleepFrames = 0;
 
             // Record death/collection in the SpawnInfo
             object->respawnInfoType = RESPAWN_INFO_TYPE_32;
@@ -482,7 +823,6 @@ void spawn_objects_from_info(UNUSED s32 unused, struct SpawnInfo *spawnInfo) {
 
             if (spawnInfo->behaviorArg & 0x01) {
                 gMarioObject = object;
-                geo_make_first_child(&object->header.gfx.node);
             }
 
             geo_obj_init_spawninfo(&object->header.gfx, spawnInfo);
@@ -502,6 +842,13 @@ void spawn_objects_from_info(UNUSED s32 unused, struct SpawnInfo *spawnInfo) {
 
         spawnInfo = spawnInfo->next;
     }
+
+    end_object_spawn_batch();
+
+    // Mario is moved to the front only once the batch has been linked in
+    if (gMarioObject != NULL) {
+        geo_make_first_child(&gMarioObject->header.gfx.node);
+    }
 }
 
 void stub_obj_list_processor_1(void) {
@@ -525,8 +872,21 @@ void clear_objects(void) {
 
     debug_unknown_level_select_check();
 
+    gObjectSlab2 = NULL;
+    gObjectSlab2Capacity = 0;
+#ifdef OBJECT_POOL_RESERVATIONS
+    if ((i = get_object_pool_reservation(gCurrLevelNum)) > 0) {
+        gObjectSlab2 = main_pool_alloc(i * sizeof(struct Object), MEMORY_POOL_LEFT);
+        if (gObjectSlab2 != NULL) {
+            gObjectSlab2Capacity = i;
+        }
+    }
+#endif
+    gObjectPoolCapacity = OBJECT_POOL_CAPACITY + gObjectSlab2Capacity;
+
     init_free_object_list();
     clear_object_lists(gObjectListArray);
+    clear_particles();
 
     stub_behavior_script_2();
     stub_obj_list_processor_1();
@@ -536,7 +896,17 @@ void clear_objects(void) {
         geo_reset_object_node(&gObjectPool[i].header.gfx);
     }
 
+    for (i = 0; i < gObjectSlab2Capacity; i++) {
+        gObjectSlab2[i].activeFlags = ACTIVE_FLAG_DEACTIVATED;
+        geo_reset_object_node(&gObjectSlab2[i].header.gfx);
+    }
+
     gObjectMemoryPool = mem_pool_init(0x800, MEMORY_POOL_LEFT);
+    clear_bhv_decode_cache();
+#ifdef TIME_STOP_EXEMPT_LIST
+    sNumTimeStopExemptObjs = 0;
+    sTimeStopFullWalkRequested = TRUE;
+#endif
     gObjectLists = gObjectListArray;
 
     clear_dynamic_surfaces();
@@ -615,6 +985,11 @@ void update_objects(UNUSED s32 unused) {
 
     gTimeStopState &= ~TIME_STOP_MARIO_OPENED_DOOR;
 
+#ifdef TIME_STOP_EXEMPT_LIST
+    sTimeStopFullWalk = sTimeStopFullWalkRequested;
+    sTimeStopFullWalkRequested = FALSE;
+#endif
+
     gNumRoomedObjectsInMarioRoom = 0;
     gNumRoomedObjectsNotInMarioRoom = 0;
     gCheckingSurfaceCollisionsForCamera = FALSE;
@@ -645,6 +1020,7 @@ void update_objects(UNUSED s32 unused) {
     // Update all other objects that haven't been updated yet
     cycleCounts[4] = get_clock_difference(cycleCounts[0]);
     update_non_terrain_objects();
+    update_particles();
 
     // Unload any objects that have been deactivated
     cycleCounts[5] = get_clock_difference(cycleCounts[0]);
@@ -658,10 +1034,19 @@ void update_objects(UNUSED s32 unused) {
 
     cycleCounts[0] = 0;
     try_print_debug_mario_object_info();
+#ifdef BEHAVIOR_PROFILER
+    update_behavior_profiler();
+    print_behavior_profile();
+#endif
 
     // If time stop was enabled this frame, activate it now so that it will
     // take effect next frame
     if (gTimeStopState & TIME_STOP_ENABLED) {
+#ifdef TIME_STOP_EXEMPT_LIST
+        if (!(gTimeStopState & TIME_STOP_ACTIVE)) {
+            sTimeStopFullWalkRequested = TRUE;
+        }
+#endif
         gTimeStopState |= TIME_STOP_ACTIVE;
     } else {
         gTimeStopState &= ~TIME_STOP_ACTIVE;
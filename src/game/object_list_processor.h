@@ -21,9 +21,12 @@
 
 
 /**
- * The maximum number of objects that can be loaded at once.
+ * The maximum number of objects that can be loaded at once, not counting any
+ * slots reserved by the current level. Configured in config.h.
  */
+#ifndef OBJECT_POOL_CAPACITY
 #define OBJECT_POOL_CAPACITY 240
+#endif
 
 /**
  * Every object is categorized into an object list, which controls the order
@@ -79,6 +82,9 @@ extern s16 gDebugInfoOverwrite[][8];
 
 extern u32 gTimeStopState;
 extern struct Object gObjectPool[];
+extern struct Object *gObjectSlab2;
+extern s32 gObjectSlab2Capacity;
+extern s32 gObjectPoolCapacity;
 extern struct Object gMacroObjectDefaultParent;
 extern struct ObjectNode *gObjectLists;
 extern struct ObjectNode gFreeObjectList;
@@ -120,6 +126,9 @@ void set_object_respawn_info_bits(struct Object *obj, u8 bits);
 void unload_objects_from_area(UNUSED s32 unused, s32 areaIndex);
 void spawn_objects_from_info(UNUSED s32 unused, struct SpawnInfo *spawnInfo);
 void clear_objects(void);
+s16 get_object_sleep_rule(const BehaviorScript *behavior);
+void obj_update_time_stop_exemption(struct Object *obj);
+void request_time_stop_full_walk(void);
 void update_objects(UNUSED s32 unused);
 
 
@@ -3,6 +3,7 @@
 #include "sm64.h"
 #include "area.h"
 #include "engine/graph_node.h"
+#include "engine/math_util.h"
 #include "engine/surface_collision.h"
 #include "game_init.h"
 #include "geo_misc.h"
@@ -718,6 +719,268 @@ void painting_average_vertex_normals(s16 *neighborTris, s16 numVtx) {
     }
 }
 
+#ifdef PAINTING_INCREMENTAL_RIPPLE
+/**
+ * Upper bounds of seg2_painting_triangle_mesh, which every painting uses.
+ */
+#define PAINTING_MESH_MAX_VTX 160
+#define PAINTING_MESH_MAX_TRIS 264
+
+/**
+ * The number of paintings that can keep a resident ripple mesh at once.
+ */
+#define PAINTING_RIPPLE_MESH_COUNT 2
+
+/**
+ * A rippling painting's mesh, kept between frames so that only the vertices whose ripple displacement
+ * changed need to be updated.
+ *
+ * The per-vertex ripple delay only depends on where the ripple started and how it spreads, so it is
+ * only recalculated when one of those parameters changes.
+ */
+struct PaintingRippleMesh {
+    struct Painting *painting;
+    /// Last gGlobalTimer this mesh was used, for picking which mesh to replace
+    u32 lastUsed;
+    /// The ripple parameters that rippleStart and rippleDelay were calculated from
+    f32 rippleX;
+    f32 rippleY;
+    f32 size;
+    f32 dispersionFactor;
+    f32 rippleRate;
+    /// The rippleTimer value when the ripple reaches each vertex
+    f32 rippleStart[PAINTING_MESH_MAX_VTX];
+    /// How far each vertex's ripple lags behind the origin, in binary angle units
+    s32 rippleDelay[PAINTING_MESH_MAX_VTX];
+    /// Triangle normals, from the cross product of the integer vertex positions
+    s32 triNorms[PAINTING_MESH_MAX_TRIS][3];
+    struct PaintingMeshVertex verts[PAINTING_MESH_MAX_VTX];
+};
+
+/**
+ * The resident meshes, allocated from the main pool for each level by alloc_painting_ripple_meshes.
+ * Paintings ripple with a mesh generated every frame while it is NULL.
+ */
+static struct PaintingRippleMesh *sPaintingRippleMeshes = NULL;
+
+/**
+ * Offset of each vertex's entry in seg2_painting_mesh_neighbor_tris, so that the neighbors of a single
+ * vertex can be found without walking the whole table.
+ */
+static s16 sPaintingNeighborEntry[PAINTING_MESH_MAX_VTX];
+static s8 sPaintingNeighborEntriesBuilt = FALSE;
+
+static u8 sPaintingTriDirty[PAINTING_MESH_MAX_TRIS];
+static u8 sPaintingVtxDirty[PAINTING_MESH_MAX_VTX];
+
+/**
+ * Allocate empty resident meshes from the main pool. Called on level load after the pool state is
+ * pushed, so that the meshes are freed along with the level.
+ */
+void alloc_painting_ripple_meshes(void) {
+    sPaintingRippleMeshes =
+        main_pool_alloc(PAINTING_RIPPLE_MESH_COUNT * sizeof(struct PaintingRippleMesh), MEMORY_POOL_LEFT);
+    if (sPaintingRippleMeshes != NULL) {
+        bzero(sPaintingRippleMeshes, PAINTING_RIPPLE_MESH_COUNT * sizeof(struct PaintingRippleMesh));
+    }
+}
+
+/**
+ * Stop using the resident meshes before the level's memory is freed.
+ */
+void free_painting_ripple_meshes(void) {
+    sPaintingRippleMeshes = NULL;
+}
+
+/**
+ * Find the resident mesh of `painting`, or replace the least recently used one.
+ *
+ * @return the mesh, with `isNew` set if its contents don't belong to the painting yet
+ */
+static struct PaintingRippleMesh *get_painting_ripple_mesh(struct Painting *painting, s8 *isNew) {
+    struct PaintingRippleMesh *ripple = &sPaintingRippleMeshes[0];
+    s32 i;
+
+    for (i = 0; i < PAINTING_RIPPLE_MESH_COUNT; i++) {
+        if (sPaintingRippleMeshes[i].painting == painting) {
+            *isNew = FALSE;
+            return &sPaintingRippleMeshes[i];
+        }
+        if (sPaintingRippleMeshes[i].lastUsed < ripple->lastUsed) {
+            ripple = &sPaintingRippleMeshes[i];
+        }
+    }
+    ripple->painting = painting;
+    *isNew = TRUE;
+    return ripple;
+}
+
+/**
+ * Recalculate when the ripple reaches each vertex, and how far behind the origin's phase it is.
+ * Mirrors the distance calculation of calculate_ripple_at_point.
+ */
+static void painting_calculate_ripple_delays(struct PaintingRippleMesh *ripple,
+                                             struct Painting *painting, s16 *mesh, s16 numVtx) {
+    f32 sizeRatio = painting->size / PAINTING_SIZE;
+    f32 dx;
+    f32 dy;
+    s16 i;
+
+    for (i = 0; i < numVtx; i++) {
+        dx = mesh[i * 3 + 1] * sizeRatio - painting->rippleX;
+        dy = mesh[i * 3 + 2] * sizeRatio - painting->rippleY;
+        ripple->rippleStart[i] = sqrtf(dx * dx + dy * dy) / painting->dispersionFactor;
+        ripple->rippleDelay[i] = ripple->rippleStart[i] * painting->currRippleRate * 65536.0f;
+    }
+
+    ripple->rippleX = painting->rippleX;
+    ripple->rippleY = painting->rippleY;
+    ripple->size = painting->size;
+    ripple->dispersionFactor = painting->dispersionFactor;
+    ripple->rippleRate = painting->currRippleRate;
+}
+
+/**
+ * Incrementally update the rippling painting's resident mesh and its vertex normals.
+ *
+ * Each vertex's ripple is evaluated with the sine table, in binary angle units. A vertex is only moved
+ * if its displacement changed by at least PAINTING_RIPPLE_THRESHOLD, and only the triangles and vertex
+ * normals around moved vertices are recalculated. If no vertex moved, last frame's mesh is reused as is.
+ *
+ * Produces the same mesh as painting_generate_mesh, painting_calculate_triangle_normals and
+ * painting_average_vertex_normals. See those functions for the format of `mesh` and `neighborTris`.
+ */
+void painting_update_ripple_mesh(struct Painting *painting, s16 *mesh, s16 *neighborTris,
+                                 s16 numVtx, s16 numTris) {
+    struct PaintingRippleMesh *ripple;
+    s16 *tris = &mesh[numVtx * 3 + 2];
+    s8 isNew;
+    s32 moved = 0;
+    s32 originAngle;
+    f32 cycles;
+    s16 i;
+    s16 j;
+
+    if (!sPaintingNeighborEntriesBuilt) {
+        s16 entry = 0;
+
+        for (i = 0; i < numVtx; i++) {
+            sPaintingNeighborEntry[i] = entry;
+            entry += neighborTris[entry] + 1;
+        }
+        sPaintingNeighborEntriesBuilt = TRUE;
+    }
+
+    ripple = get_painting_ripple_mesh(painting, &isNew);
+    ripple->lastUsed = gGlobalTimer;
+    gPaintingMesh = ripple->verts;
+
+    if (isNew || ripple->rippleX != painting->rippleX || ripple->rippleY != painting->rippleY
+        || ripple->size != painting->size || ripple->dispersionFactor != painting->dispersionFactor
+        || ripple->rippleRate != painting->currRippleRate) {
+        painting_calculate_ripple_delays(ripple, painting, mesh, numVtx);
+    }
+
+    // The phase of the ripple at its origin. Only the fractional part of the cycle count matters, and
+    // dropping the whole part keeps the angle in range as the timer grows.
+    cycles = painting->currRippleRate * painting->rippleTimer;
+    cycles -= (s32) cycles;
+    originAngle = cycles * 65536.0f;
+
+    bzero(sPaintingTriDirty, numTris * sizeof(sPaintingTriDirty[0]));
+    bzero(sPaintingVtxDirty, numVtx * sizeof(sPaintingVtxDirty[0]));
+
+    for (i = 0; i < numVtx; i++) {
+        struct PaintingMeshVertex *vtx = &ripple->verts[i];
+        s16 z = 0;
+        s16 dz;
+
+        // The "z coordinate" of each vertex in the mesh determines whether the vertex moves
+        if (mesh[i * 3 + 3] && painting->rippleTimer >= ripple->rippleStart[i]) {
+            z = round_float(painting->currRippleMag * coss(originAngle - ripple->rippleDelay[i]));
+        }
+
+        if (isNew) {
+            vtx->pos[0] = mesh[i * 3 + 1];
+            vtx->pos[1] = mesh[i * 3 + 2];
+        } else {
+            dz = z - vtx->pos[2];
+            if (dz == 0 || (dz < PAINTING_RIPPLE_THRESHOLD && dz > -PAINTING_RIPPLE_THRESHOLD)) {
+                continue;
+            }
+        }
+        vtx->pos[2] = z;
+        moved++;
+
+        for (j = 0; j < neighborTris[sPaintingNeighborEntry[i]]; j++) {
+            sPaintingTriDirty[neighborTris[sPaintingNeighborEntry[i] + j + 1]] = TRUE;
+        }
+    }
+
+    if (moved == 0) {
+        return;
+    }
+
+    for (i = 0; i < numTris; i++) {
+        struct PaintingMeshVertex *v0;
+        struct PaintingMeshVertex *v1;
+        struct PaintingMeshVertex *v2;
+        s32 *norm;
+
+        if (!sPaintingTriDirty[i]) {
+            continue;
+        }
+        v0 = &ripple->verts[tris[i * 3]];
+        v1 = &ripple->verts[tris[i * 3 + 1]];
+        v2 = &ripple->verts[tris[i * 3 + 2]];
+        norm = ripple->triNorms[i];
+
+        // Cross product to find the triangle's normal vector
+        norm[0] = (v1->pos[1] - v0->pos[1]) * (v2->pos[2] - v1->pos[2])
+                  - (v1->pos[2] - v0->pos[2]) * (v2->pos[1] - v1->pos[1]);
+        norm[1] = (v1->pos[2] - v0->pos[2]) * (v2->pos[0] - v1->pos[0])
+                  - (v1->pos[0] - v0->pos[0]) * (v2->pos[2] - v1->pos[2]);
+        norm[2] = (v1->pos[0] - v0->pos[0]) * (v2->pos[1] - v1->pos[1])
+                  - (v1->pos[1] - v0->pos[1]) * (v2->pos[0] - v1->pos[0]);
+
+        sPaintingVtxDirty[tris[i * 3]] = TRUE;
+        sPaintingVtxDirty[tris[i * 3 + 1]] = TRUE;
+        sPaintingVtxDirty[tris[i * 3 + 2]] = TRUE;
+    }
+
+    for (i = 0; i < numVtx; i++) {
+        s16 entry = sPaintingNeighborEntry[i];
+        s32 nx = 0;
+        s32 ny = 0;
+        s32 nz = 0;
+        f32 nlen;
+
+        if (!sPaintingVtxDirty[i]) {
+            continue;
+        }
+        // The direction of the sum is the same as that of the average
+        for (j = 0; j < neighborTris[entry]; j++) {
+            s32 *norm = ripple->triNorms[neighborTris[entry + j + 1]];
+
+            nx += norm[0];
+            ny += norm[1];
+            nz += norm[2];
+        }
+
+        nlen = sqrtf((f32) nx * nx + (f32) ny * ny + (f32) nz * nz);
+        if (nlen == 0.0f) {
+            ripple->verts[i].norm[0] = 0;
+            ripple->verts[i].norm[1] = 0;
+            ripple->verts[i].norm[2] = 0;
+        } else {
+            ripple->verts[i].norm[0] = normalize_component(nx / nlen);
+            ripple->verts[i].norm[1] = normalize_component(ny / nlen);
+            ripple->verts[i].norm[2] = normalize_component(nz / nlen);
+        }
+    }
+}
+#endif
+
 /**
  * Creates a display list that draws the rippling painting, with 'img' mapped to the painting's mesh,
  * using 'textureMap'.
@@ -878,7 +1141,8 @@ Gfx *painting_ripple_image(struct Painting *painting) {
 
 /**
  * Generates a mesh, calculates vertex normals for lighting, and renders a rippling painting.
- * The mesh and vertex normals are regenerated and freed every frame.
+ * The mesh and vertex normals are regenerated and freed every frame, unless PAINTING_INCREMENTAL_RIPPLE
+ * keeps them resident in the level's ripple meshes.
  */
 Gfx *display_painting_rippling(struct Painting *painting) {
     s16 *mesh = segmented_to_virtual(seg2_painting_triangle_mesh);
@@ -887,6 +1151,13 @@ Gfx *display_painting_rippling(struct Painting *painting) {
     s16 numTris = mesh[numVtx * 3 + 1];
     Gfx *dlist;
 
+#ifdef PAINTING_INCREMENTAL_RIPPLE
+    if (sPaintingRippleMeshes != NULL) {
+        painting_update_ripple_mesh(painting, mesh, neighborTris, numVtx, numTris);
+        return painting_ripple_image(painting);
+    }
+#endif
+
     // Generate the mesh and its lighting data
     painting_generate_mesh(painting, mesh, numVtx);
     painting_calculate_triangle_normals(mesh, numVtx, numTris);
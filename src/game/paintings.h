@@ -131,5 +131,9 @@ extern s8 gDDDPaintingStatus;
 
 Gfx *geo_painting_draw(s32 callContext, struct GraphNode *node, UNUSED void *context);
 Gfx *geo_painting_update(s32 callContext, UNUSED struct GraphNode *node, UNUSED Mat4 c);
+#ifdef PAINTING_INCREMENTAL_RIPPLE
+void alloc_painting_ripple_meshes(void);
+void free_painting_ripple_meshes(void);
+#endif
 
 #endif // PAINTINGS_H
@@ -0,0 +1,479 @@
+#include <PR/ultratypes.h>
+
+#include "sm64.h"
+#include "area.h"
+#include "engine/graph_node.h"
+#include "engine/math_util.h"
+#include "engine/surface_collision.h"
+#include "game_init.h"
+#include "memory.h"
+#include "object_list_processor.h"
+#include "particle_system.h"
+
+/**
+ * @file particle_system.c
+ * A lightweight particle system for short-lived sprites and debris. Unlike
+ * particles spawned as objects, these don't take an object slot, don't run a
+ * behavior script, and don't collide with anything. Their state lives in the
+ * structure of arrays gParticles, and they are all drawn by a single call to
+ * render_particles from the object parent graph node.
+ *
+ * A particle's appearance is taken from the geo layout of its model. The
+ * first display list node under the model is drawn, and if the model starts
+ * with a switch case node, the particle's anim state selects the case, just
+ * like geo_switch_anim_state does for objects.
+ */
+
+/**
+ * The particles, allocated from the main pool for each level by alloc_particles.
+ * No particles can be spawned while it is NULL.
+ */
+struct ParticleBuffer *gParticles = NULL;
+
+/**
+ * Per-particle draw info computed by the first pass of render_particles.
+ */
+static Mtx *sParticleMtx[PARTICLE_POOL_CAPACITY];
+static Gfx *sParticleDisplayList[PARTICLE_POOL_CAPACITY];
+static s8 sParticleLayer[PARTICLE_POOL_CAPACITY];
+#ifdef FAST_BILLBOARD_MTX
+/**
+ * Indices of the visible particles, sorted by layer and then display list.
+ */
+static s16 sParticleDrawOrder[PARTICLE_POOL_CAPACITY];
+#endif
+
+/**
+ * Remove every particle. Called when objects are cleared on level load.
+ */
+void clear_particles(void) {
+    if (gParticles != NULL) {
+        gParticles->count = 0;
+    }
+}
+
+/**
+ * Allocate an empty particle buffer from the main pool. Called on level load
+ * after the pool state is pushed, so that the buffer is freed along with the
+ * level.
+ */
+void alloc_particles(void) {
+    gParticles = main_pool_alloc(sizeof(struct ParticleBuffer), MEMORY_POOL_LEFT);
+    clear_particles();
+}
+
+/**
+ * Stop using the particle buffer before the level's memory is freed.
+ */
+void free_particles(void) {
+    gParticles = NULL;
+}
+
+/**
+ * Spawn a particle with the given model at (x, y, z). It starts at rest,
+ * unscaled, fully opaque, and dies after lifetime frames.
+ * Return the index of the particle, or -1 if the buffer is full. Particles
+ * that die below the floor are not spawned if there is no floor beneath them,
+ * like the leaf objects that deleted themselves when out of bounds.
+ */
+s32 spawn_particle_at(s32 model, f32 x, f32 y, f32 z, s32 lifetime, s32 flags) {
+    f32 floorHeight = FLOOR_LOWER_LIMIT;
+    s32 i;
+
+    if (gParticles == NULL || (i = gParticles->count) >= PARTICLE_POOL_CAPACITY) {
+        return -1;
+    }
+
+    if ((flags & PARTICLE_FLAG_DIE_BELOW_FLOOR)
+        && (floorHeight = find_floor_height(x, y, z)) < FLOOR_LOWER_LIMIT_MISC) {
+        return -1;
+    }
+
+    gParticles->count++;
+
+    gParticles->posX[i] = x;
+    gParticles->posY[i] = y;
+    gParticles->posZ[i] = z;
+    gParticles->velX[i] = 0.0f;
+    gParticles->velY[i] = 0.0f;
+    gParticles->velZ[i] = 0.0f;
+    gParticles->gravity[i] = 0.0f;
+    gParticles->dragStrength[i] = 0.0f;
+    gParticles->minVelY[i] = -10000.0f;
+    gParticles->maxVelY[i] = 10000.0f;
+    gParticles->scale[i] = 1.0f;
+    vec3s_copy(gParticles->angle[i], gVec3sZero);
+    vec3s_copy(gParticles->angleVel[i], gVec3sZero);
+    gParticles->alpha[i] = 255;
+    gParticles->alphaVel[i] = 0;
+    gParticles->model[i] = model;
+    gParticles->animState[i] = 0;
+    gParticles->timer[i] = 0;
+    gParticles->lifetime[i] = lifetime;
+    gParticles->flags[i] = flags;
+    gParticles->floorHeight[i] = floorHeight;
+
+    return i;
+}
+
+/**
+ * Spawn a particle at the given object's position, facing the same way.
+ */
+s32 spawn_particle_at_object(struct Object *obj, s32 model, s32 lifetime, s32 flags) {
+    s32 i = spawn_particle_at(model, obj->oPosX, obj->oPosY, obj->oPosZ, lifetime, flags);
+
+    if (i >= 0) {
+        gParticles->angle[i][0] = obj->oFaceAnglePitch;
+        gParticles->angle[i][1] = obj->oFaceAngleYaw;
+        gParticles->angle[i][2] = obj->oFaceAngleRoll;
+    }
+
+    return i;
+}
+
+/**
+ * Set a particle's horizontal velocity from a yaw and forward speed.
+ */
+void particle_set_forward_vel(s32 index, s16 yaw, f32 forwardVel) {
+    gParticles->velX[index] = forwardVel * sins(yaw);
+    gParticles->velZ[index] = forwardVel * coss(yaw);
+}
+
+/**
+ * Same as apply_drag_to_value in object_helpers.c.
+ */
+static f32 particle_apply_drag(f32 value, f32 dragStrength) {
+    f32 decel;
+
+    if (value != 0) {
+        decel = value * value * (dragStrength * 0.0001L);
+
+        if (value > 0) {
+            value -= decel;
+            if (value < 0.001L) {
+                value = 0;
+            }
+        } else {
+            value += decel;
+            if (value > -0.001L) {
+                value = 0;
+            }
+        }
+    }
+
+    return value;
+}
+
+/**
+ * Overwrite particle i with the last live particle, keeping the buffer packed.
+ */
+static void kill_particle(s32 i) {
+    s32 last = --gParticles->count;
+
+    if (i == last) {
+        return;
+    }
+
+    gParticles->posX[i] = gParticles->posX[last];
+    gParticles->posY[i] = gParticles->posY[last];
+    gParticles->posZ[i] = gParticles->posZ[last];
+    gParticles->velX[i] = gParticles->velX[last];
+    gParticles->velY[i] = gParticles->velY[last];
+    gParticles->velZ[i] = gParticles->velZ[last];
+    gParticles->gravity[i] = gParticles->gravity[last];
+    gParticles->dragStrength[i] = gParticles->dragStrength[last];
+    gParticles->minVelY[i] = gParticles->minVelY[last];
+    gParticles->maxVelY[i] = gParticles->maxVelY[last];
+    gParticles->floorHeight[i] = gParticles->floorHeight[last];
+    gParticles->scale[i] = gParticles->scale[last];
+    vec3s_copy(gParticles->angle[i], gParticles->angle[last]);
+    vec3s_copy(gParticles->angleVel[i], gParticles->angleVel[last]);
+    gParticles->alpha[i] = gParticles->alpha[last];
+    gParticles->alphaVel[i] = gParticles->alphaVel[last];
+    gParticles->model[i] = gParticles->model[last];
+    gParticles->animState[i] = gParticles->animState[last];
+    gParticles->timer[i] = gParticles->timer[last];
+    gParticles->lifetime[i] = gParticles->lifetime[last];
+    gParticles->flags[i] = gParticles->flags[last];
+}
+
+/**
+ * Advance every particle by one frame. Particles are frozen along with other
+ * objects when time stop freezes all objects.
+ */
+void update_particles(void) {
+    s32 i;
+    u8 flags;
+
+    if (gParticles == NULL
+        || ((gTimeStopState & TIME_STOP_ACTIVE) && (gTimeStopState & TIME_STOP_ALL_OBJECTS))) {
+        return;
+    }
+
+    // Move the particles
+    for (i = 0; i < gParticles->count; i++) {
+        gParticles->velY[i] += gParticles->gravity[i];
+        if (gParticles->velY[i] < gParticles->minVelY[i]) {
+            gParticles->velY[i] = gParticles->minVelY[i];
+        } else if (gParticles->velY[i] > gParticles->maxVelY[i]) {
+            gParticles->velY[i] = gParticles->maxVelY[i];
+        }
+
+        gParticles->posX[i] += gParticles->velX[i];
+        gParticles->posY[i] += gParticles->velY[i];
+        gParticles->posZ[i] += gParticles->velZ[i];
+    }
+
+    // Apply drag, spin, fade and animation, and remove dead particles. This
+    // iterates backwards so that a killed particle is replaced by one that
+    // has already been visited.
+    for (i = gParticles->count - 1; i >= 0; i--) {
+        flags = gParticles->flags[i];
+
+        if (gParticles->dragStrength[i] != 0.0f) {
+            gParticles->velX[i] = particle_apply_drag(gParticles->velX[i], gParticles->dragStrength[i]);
+            gParticles->velZ[i] = particle_apply_drag(gParticles->velZ[i], gParticles->dragStrength[i]);
+        }
+
+        gParticles->angle[i][0] += gParticles->angleVel[i][0];
+        gParticles->angle[i][1] += gParticles->angleVel[i][1];
+        gParticles->angle[i][2] += gParticles->angleVel[i][2];
+
+        if (flags & PARTICLE_FLAG_ANIMATE) {
+            gParticles->animState[i]++;
+        }
+
+        if (flags & PARTICLE_FLAG_FADE) {
+            gParticles->alpha[i] += gParticles->alphaVel[i];
+        }
+
+        if (++gParticles->timer[i] >= gParticles->lifetime[i]
+            || ((flags & PARTICLE_FLAG_FADE) && gParticles->alpha[i] < 2)
+            || gParticles->posY[i] < gParticles->floorHeight[i]) {
+            kill_particle(i);
+        }
+    }
+}
+
+/**
+ * Find the display list node that a particle with the given anim state
+ * should draw, searching the siblings of node and their descendants.
+ */
+static struct GraphNodeDisplayList *find_particle_display_list(struct GraphNode *node, s32 animState) {
+    struct GraphNode *firstNode = node;
+    struct GraphNodeDisplayList *found;
+    struct GraphNodeSwitchCase *switchCase;
+    s32 i;
+
+    if (node == NULL) {
+        return NULL;
+    }
+
+    do {
+        switch (node->type) {
+            case GRAPH_NODE_TYPE_DISPLAY_LIST:
+                if (((struct GraphNodeDisplayList *) node)->displayList != NULL) {
+                    return (struct GraphNodeDisplayList *) node;
+                }
+                break;
+
+            case GRAPH_NODE_TYPE_SWITCH_CASE:
+                switchCase = (struct GraphNodeSwitchCase *) node;
+                node = switchCase->fnNode.node.children;
+                for (i = animState % switchCase->numCases; node != NULL && i > 0; i--) {
+                    node = node->next;
+                }
+                if (node != NULL && node->type == GRAPH_NODE_TYPE_DISPLAY_LIST) {
+                    return (struct GraphNodeDisplayList *) node;
+                }
+                return find_particle_display_list(node != NULL ? node->children : NULL, animState);
+
+            default:
+                break;
+        }
+
+        if ((found = find_particle_display_list(node->children, animState)) != NULL) {
+            return found;
+        }
+    } while ((node = node->next) != firstNode);
+
+    return NULL;
+}
+
+#ifdef FAST_BILLBOARD_MTX
+/**
+ * Insert the visible particle i into sParticleDrawOrder, which holds count
+ * particles. The order is kept stable, so particles sharing a display list
+ * are still drawn in spawn order.
+ */
+static void insert_particle_draw_order(s32 i, s32 count) {
+    s32 j;
+
+    // Insertion sort, particles of one emitter are usually adjacent already
+    for (j = count; j > 0; j--) {
+        s32 prev = sParticleDrawOrder[j - 1];
+
+        if (sParticleLayer[prev] < sParticleLayer[i]
+            || (sParticleLayer[prev] == sParticleLayer[i]
+                && (uintptr_t) sParticleDisplayList[prev] <= (uintptr_t) sParticleDisplayList[i])) {
+            break;
+        }
+        sParticleDrawOrder[j] = prev;
+    }
+    sParticleDrawOrder[j] = i;
+}
+#endif
+
+/**
+ * Build the display lists that draw every particle, one per master list
+ * layer. layerLists[layer] is set to NULL for layers with no particles.
+ * cameraMtx is the camera's look-at matrix from the top of the matrix stack.
+ */
+void render_particles(Gfx **layerLists, Mat4 cameraMtx, s16 roll) {
+    s32 layerCounts[GFX_NUM_MASTER_LISTS];
+    struct GraphNodeDisplayList *dlNode;
+    struct GraphNode *model;
+    Mat4 mtxf;
+    Mat4 mtxfLocal;
+    Vec3f pos;
+    Vec3f scaleVec;
+    f32 scale;
+    Gfx *gfx;
+    s32 lastAlpha;
+#ifdef FAST_BILLBOARD_MTX
+    s32 alpha;
+#endif
+    s32 layer;
+    s32 i;
+#ifdef FAST_BILLBOARD_MTX
+    s32 numVisible = 0;
+    s32 first;
+    s32 j;
+#endif
+
+    for (layer = 0; layer < GFX_NUM_MASTER_LISTS; layer++) {
+        layerCounts[layer] = 0;
+        layerLists[layer] = NULL;
+    }
+
+    // Compute each particle's matrix and display list
+    for (i = 0; i < gParticles->count; i++) {
+        sParticleLayer[i] = -1;
+
+        if ((model = gLoadedGraphNodes[gParticles->model[i]]) == NULL) {
+            continue;
+        }
+        if ((dlNode = find_particle_display_list(model, gParticles->animState[i])) == NULL) {
+            continue;
+        }
+
+        vec3f_set(pos, gParticles->posX[i], gParticles->posY[i], gParticles->posZ[i]);
+        if (gParticles->flags[i] & PARTICLE_FLAG_BILLBOARD) {
+            mtxf_billboard(mtxf, cameraMtx, pos, roll);
+        } else {
+            mtxf_rotate_zxy_and_translate(mtxfLocal, pos, gParticles->angle[i]);
+            mtxf_mul(mtxf, mtxfLocal, cameraMtx);
+        }
+
+        // Skip particles that are behind the camera or too far away. Particles
+        // that cross the near plane are left to the RDP to clip.
+        if (mtxf[3][2] > 0.0f || mtxf[3][2] < -20000.0f) {
+            continue;
+        }
+
+        scale = gParticles->scale[i];
+        if (gParticles->flags[i] & PARTICLE_FLAG_SCALE_WITH_ALPHA) {
+            scale *= gParticles->alpha[i] / 254.0f;
+        } else if (gParticles->flags[i] & PARTICLE_FLAG_GROW_WITH_ALPHA) {
+            scale *= (254 - gParticles->alpha[i]) / 254.0f;
+        }
+        vec3f_set(scaleVec, scale, scale, scale);
+        mtxf_scale_vec3f(mtxf, mtxf, scaleVec);
+
+        if ((sParticleMtx[i] = alloc_display_list(sizeof(Mtx))) == NULL) {
+            continue;
+        }
+#ifdef FAST_BILLBOARD_MTX
+        if (gParticles->flags[i] & PARTICLE_FLAG_BILLBOARD) {
+            mtxf_billboard_to_mtx(sParticleMtx[i], mtxf);
+        } else
+#endif
+        mtxf_to_mtx(sParticleMtx[i], mtxf);
+
+        // Faded particles are drawn translucent, like geo_update_layer_transparency does
+        layer = dlNode->node.flags >> 8;
+        if ((gParticles->flags[i] & PARTICLE_FLAG_FADE) && layer < LAYER_TRANSPARENT) {
+            layer = LAYER_TRANSPARENT;
+        }
+
+        sParticleDisplayList[i] = dlNode->displayList;
+        sParticleLayer[i] = layer;
+        layerCounts[layer]++;
+#ifdef FAST_BILLBOARD_MTX
+        insert_particle_draw_order(i, numVisible++);
+#endif
+    }
+
+#ifdef FAST_BILLBOARD_MTX
+    // Each layer's particles are contiguous in sParticleDrawOrder
+    j = 0;
+#endif
+
+    // Emit one display list per layer
+    for (layer = 0; layer < GFX_NUM_MASTER_LISTS; layer++) {
+#ifdef FAST_BILLBOARD_MTX
+        first = j;
+        j += layerCounts[layer];
+#endif
+        if (layerCounts[layer] == 0) {
+            continue;
+        }
+
+        if ((gfx = alloc_display_list((layerCounts[layer] * 3 + 2) * sizeof(Gfx))) == NULL) {
+            continue;
+        }
+        layerLists[layer] = gfx;
+
+#ifdef FAST_BILLBOARD_MTX
+        // Draw particles with the same display list one after another, and
+        // only set the env color when the alpha changes. Particles that don't
+        // fade are drawn opaque.
+        lastAlpha = -1;
+        for (; first < j; first++) {
+            i = sParticleDrawOrder[first];
+
+            gSPMatrix(gfx++, VIRTUAL_TO_PHYSICAL(sParticleMtx[i]),
+                      G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_NOPUSH);
+            alpha = (gParticles->flags[i] & PARTICLE_FLAG_FADE) ? gParticles->alpha[i] : 255;
+            if (alpha != lastAlpha) {
+                gDPSetEnvColor(gfx++, 255, 255, 255, alpha);
+                lastAlpha = alpha;
+            }
+            gSPDisplayList(gfx++, sParticleDisplayList[i]);
+        }
+#else
+        // Particles that don't fade are drawn opaque, so the env color is
+        // reset after a faded particle
+        lastAlpha = 255;
+        for (i = 0; i < gParticles->count; i++) {
+            if (sParticleLayer[i] != layer) {
+                continue;
+            }
+
+            gSPMatrix(gfx++, VIRTUAL_TO_PHYSICAL(sParticleMtx[i]),
+                      G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_NOPUSH);
+            if (gParticles->flags[i] & PARTICLE_FLAG_FADE) {
+                gDPSetEnvColor(gfx++, 255, 255, 255, gParticles->alpha[i]);
+                lastAlpha = gParticles->alpha[i];
+            } else if (lastAlpha != 255) {
+                gDPSetEnvColor(gfx++, 255, 255, 255, 255);
+                lastAlpha = 255;
+            }
+            gSPDisplayList(gfx++, sParticleDisplayList[i]);
+        }
+#endif
+
+        gDPSetEnvColor(gfx++, 255, 255, 255, 255);
+        gSPEndDisplayList(gfx++);
+    }
+}
@@ -0,0 +1,73 @@
+#ifndef PARTICLE_SYSTEM_H
+#define PARTICLE_SYSTEM_H
+
+#include <PR/ultratypes.h>
+#include <PR/gbi.h>
+
+#include "types.h"
+
+/**
+ * The maximum number of lightweight particles that can be alive at once.
+ * Configured in config.h.
+ */
+#ifndef PARTICLE_POOL_CAPACITY
+#define PARTICLE_POOL_CAPACITY 128
+#endif
+
+/**
+ * Flags controlling how a particle moves and is drawn.
+ */
+#define PARTICLE_FLAG_BILLBOARD         (1 << 0) // face the camera instead of using pitch/yaw/roll
+#define PARTICLE_FLAG_ANIMATE           (1 << 1) // advance the model's anim state every frame
+#define PARTICLE_FLAG_FADE              (1 << 2) // add alphaVel to alpha every frame, die when faded out
+#define PARTICLE_FLAG_SCALE_WITH_ALPHA  (1 << 3) // shrink along with alpha
+#define PARTICLE_FLAG_GROW_WITH_ALPHA   (1 << 4) // grow as alpha fades
+#define PARTICLE_FLAG_DIE_BELOW_FLOOR   (1 << 5) // die when falling below the floor found at spawn
+
+/**
+ * Lightweight particle state, stored as a structure of arrays so that the
+ * update loop only touches the fields it needs. Live particles are kept
+ * packed at the start of each array; gParticles->count is the number alive.
+ *
+ * Particles have no behavior script, collision, or graph node. They move
+ * with fixed-function motion (velocity, gravity, quadratic xz drag,
+ * terminal velocity, spin and fade), and are all drawn in one batch by the
+ * object parent graph node.
+ */
+struct ParticleBuffer {
+    f32 posX[PARTICLE_POOL_CAPACITY];
+    f32 posY[PARTICLE_POOL_CAPACITY];
+    f32 posZ[PARTICLE_POOL_CAPACITY];
+    f32 velX[PARTICLE_POOL_CAPACITY];
+    f32 velY[PARTICLE_POOL_CAPACITY];
+    f32 velZ[PARTICLE_POOL_CAPACITY];
+    f32 gravity[PARTICLE_POOL_CAPACITY];
+    f32 dragStrength[PARTICLE_POOL_CAPACITY];
+    f32 minVelY[PARTICLE_POOL_CAPACITY];
+    f32 maxVelY[PARTICLE_POOL_CAPACITY];
+    f32 floorHeight[PARTICLE_POOL_CAPACITY];
+    f32 scale[PARTICLE_POOL_CAPACITY];
+    Vec3s angle[PARTICLE_POOL_CAPACITY];
+    Vec3s angleVel[PARTICLE_POOL_CAPACITY];
+    s16 alpha[PARTICLE_POOL_CAPACITY];
+    s16 alphaVel[PARTICLE_POOL_CAPACITY];
+    u8 model[PARTICLE_POOL_CAPACITY];
+    u8 animState[PARTICLE_POOL_CAPACITY];
+    u8 timer[PARTICLE_POOL_CAPACITY];
+    u8 lifetime[PARTICLE_POOL_CAPACITY];
+    u8 flags[PARTICLE_POOL_CAPACITY];
+    s32 count;
+};
+
+extern struct ParticleBuffer *gParticles;
+
+void clear_particles(void);
+void alloc_particles(void);
+void free_particles(void);
+s32 spawn_particle_at(s32 model, f32 x, f32 y, f32 z, s32 lifetime, s32 flags);
+s32 spawn_particle_at_object(struct Object *obj, s32 model, s32 lifetime, s32 flags);
+void particle_set_forward_vel(s32 index, s16 yaw, f32 forwardVel);
+void update_particles(void);
+void render_particles(Gfx **layerLists, Mat4 cameraMtx, s16 roll);
+
+#endif // PARTICLE_SYSTEM_H
@@ -177,6 +177,11 @@ void print_text_fmt_int(s32 x, s32 y, const char *str, s32 n) {
     s32 len = 0;
     s32 srcIndex = 0;
 
+    // Drop the label if there is no room left for it.
+    if (sTextLabelsCount >= ARRAY_COUNT(sTextLabels)) {
+        return;
+    }
+
     // Don't continue if there is no memory to do so.
     if ((sTextLabels[sTextLabelsCount] = mem_pool_alloc(gEffectsMemoryPool, sizeof(struct TextLabel)))
         == NULL) {
@@ -228,6 +233,11 @@ void print_text(s32 x, s32 y, const char *str) {
     s32 length = 0;
     s32 srcIndex = 0;
 
+    // Drop the label if there is no room left for it.
+    if (sTextLabelsCount >= ARRAY_COUNT(sTextLabels)) {
+        return;
+    }
+
     // Don't continue if there is no memory to do so.
     if ((sTextLabels[sTextLabelsCount] = mem_pool_alloc(gEffectsMemoryPool, sizeof(struct TextLabel)))
         == NULL) {
@@ -262,6 +272,11 @@ void print_text_centered(s32 x, s32 y, const char *str) {
     s32 length = 0;
     s32 srcIndex = 0;
 
+    // Drop the label if there is no room left for it.
+    if (sTextLabelsCount >= ARRAY_COUNT(sTextLabels)) {
+        return;
+    }
+
     // Don't continue if there is no memory to do so.
     if ((sTextLabels[sTextLabelsCount] = mem_pool_alloc(gEffectsMemoryPool, sizeof(struct TextLabel)))
         == NULL) {
@@ -405,14 +420,56 @@ void render_textrect(s32 x, s32 y, s32 pos) {
                         (rectY + 15) << 2, G_TX_RENDERTILE, 0, 0, 4 << 10, 1 << 10);
 }
 
+#ifdef TEXT_GLYPH_BATCHING
+/**
+ * Renders the text in sTextLabels grouped by glyph instead of by label, so that
+ * the texture of every glyph is loaded only once, no matter how many labels use it.
+ * The labels' chars are replaced with their glyph indices.
+ */
+static void render_text_labels_by_glyph(void) {
+    u32 glyphsUsed[2] = { 0, 0 };
+    s32 glyphIndex;
+    s32 i;
+    s32 j;
+
+    for (i = 0; i < sTextLabelsCount; i++) {
+        for (j = 0; j < sTextLabels[i]->length; j++) {
+            glyphIndex = char_to_glyph_index(sTextLabels[i]->buffer[j]);
+            sTextLabels[i]->buffer[j] = glyphIndex;
+
+            if (glyphIndex != GLYPH_SPACE) {
+                glyphsUsed[glyphIndex >> 5] |= 1U << (glyphIndex & 31);
+            }
+        }
+    }
+
+    for (glyphIndex = 0; glyphIndex < 64; glyphIndex++) {
+        if (!(glyphsUsed[glyphIndex >> 5] & (1U << (glyphIndex & 31)))) {
+            continue;
+        }
+
+        add_glyph_texture(glyphIndex);
+        for (i = 0; i < sTextLabelsCount; i++) {
+            for (j = 0; j < sTextLabels[i]->length; j++) {
+                if (sTextLabels[i]->buffer[j] == glyphIndex) {
+                    render_textrect(sTextLabels[i]->x, sTextLabels[i]->y, j);
+                }
+            }
+        }
+    }
+}
+#endif
+
 /**
  * Renders the text in sTextLabels on screen at the proper locations by iterating
  * a for loop.
  */
 void render_text_labels(void) {
     s32 i;
+#ifndef TEXT_GLYPH_BATCHING
     s32 j;
     s8 glyphIndex;
+#endif
     Mtx *mtx;
 
     if (sTextLabelsCount == 0) {
@@ -433,6 +490,13 @@ void render_text_labels(void) {
               G_MTX_PROJECTION | G_MTX_LOAD | G_MTX_NOPUSH);
     gSPDisplayList(gDisplayListHead++, dl_hud_img_begin);
 
+#ifdef TEXT_GLYPH_BATCHING
+    render_text_labels_by_glyph();
+
+    for (i = 0; i < sTextLabelsCount; i++) {
+        mem_pool_free(gEffectsMemoryPool, sTextLabels[i]);
+    }
+#else
     for (i = 0; i < sTextLabelsCount; i++) {
         for (j = 0; j < sTextLabels[i]->length; j++) {
             glyphIndex = char_to_glyph_index(sTextLabels[i]->buffer[j]);
@@ -445,6 +509,7 @@ void render_text_labels(void) {
 
         mem_pool_free(gEffectsMemoryPool, sTextLabels[i]);
     }
+#endif
 
     gSPDisplayList(gDisplayListHead++, dl_hud_img_end);
 
@@ -5,6 +5,11 @@
 #include "sm64.h"
 #include "profiler.h"
 #include "game_init.h"
+#include "main.h"
+#include "print.h"
+#ifdef BEHAVIOR_PROFILER
+#include "behavior_profiler.h"
+#endif
 
 s16 gProfilerMode = 0;
 
@@ -18,6 +23,12 @@ s16 gCurrentFrameIndex2 = 0;
 
 struct ProfilerFrameData gProfilerFrameData[2];
 
+// gNumVblanks when the last frame was sent to the VI, and when that frame started.
+static u32 sPresentVblank;
+static OSTime sPresentFrameStart;
+// Time from the start of the last presented frame until it appeared on screen.
+static OSTime sPresentLatency;
+
 // log the current osTime to the appropriate idx for current thread5 processes.
 void profiler_log_thread5_time(enum ProfilerGameEvent eventID) {
     gProfilerFrameData[gCurrentFrameIndex1].gameTimes[eventID] = osGetTime();
@@ -58,6 +69,21 @@ void profiler_log_vblank_time(void) {
     }
 }
 
+// log that the frame rendered last was sent to the VI. It appears on the vblank after
+// this, so the latency of the previous presented frame is known by now.
+void profiler_log_present(void) {
+    u32 elapsed = gNumVblanks - sPresentVblank;
+
+    if (elapsed >= 1 && elapsed <= ARRAY_COUNT(gVblankTimes)) {
+        sPresentLatency =
+            gVblankTimes[(sPresentVblank + 1) % ARRAY_COUNT(gVblankTimes)] - sPresentFrameStart;
+    }
+
+    sPresentVblank = gNumVblanks;
+    // The buffer being swapped in was rendered by the previous game frame
+    sPresentFrameStart = gProfilerFrameData[gCurrentFrameIndex1 ^ 1].gameTimes[THREAD5_START];
+}
+
 // draw the specified profiler given the information passed.
 void draw_profiler_bar(OSTime clockBase, OSTime clockStart, OSTime clockEnd, s16 posY, u16 color) {
     s64 durationStart, durationEnd;
@@ -292,6 +318,51 @@ void draw_profiler_mode_0(void) {
     draw_reference_profiler_bars();
 }
 
+// convert an osGetTime duration to microseconds.
+static s32 profiler_usec(OSTime duration) {
+    return duration * 1000000 / osClockRate;
+}
+
+/*
+  Print the frame times of the last frame in microseconds:
+
+  GAME: thread 5 start to display lists sent (game logic and rendering)
+  RSP: SP tasks queued to RSP complete
+  RDP: SP tasks queued to RDP complete
+  LAT: thread 5 start to the vblank the frame appeared on
+
+  With the SP task scheduler, also the total number of gfx task yields, their average
+  time to yield, and the number of SP tasks that missed their deadline.
+
+  The frame times are printed in the lower left of the screen, which the behavior
+  profile takes over while it is enabled. The yield stats are printed on the right,
+  above the debug text.
+*/
+static void print_frame_pacing_stats(void) {
+    struct ProfilerFrameData *profiler = &gProfilerFrameData[gCurrentFrameIndex1 ^ 1];
+
+#ifdef BEHAVIOR_PROFILER
+    if (!gBehaviorProfilerEnabled)
+#endif
+    {
+        print_text_fmt_int(20, 96, "GAME %d",
+                           profiler_usec(profiler->gameTimes[BEFORE_DISPLAY_LISTS]
+                                         - profiler->gameTimes[THREAD5_START]));
+        print_text_fmt_int(20, 80, "RSP %d",
+                           profiler_usec(profiler->gfxTimes[RSP_COMPLETE] - profiler->gfxTimes[TASKS_QUEUED]));
+        print_text_fmt_int(20, 64, "RDP %d",
+                           profiler_usec(profiler->gfxTimes[RDP_COMPLETE] - profiler->gfxTimes[TASKS_QUEUED]));
+        print_text_fmt_int(20, 48, "LAT %d", profiler_usec(sPresentLatency));
+    }
+#ifdef SPTASK_SCHEDULER
+    print_text_fmt_int(180, 180, "YLD %d", gSPTaskStats.yields);
+    if (gSPTaskStats.yields != 0) {
+        print_text_fmt_int(180, 164, "YLDT %d", profiler_usec(gSPTaskStats.yieldTime / gSPTaskStats.yields));
+    }
+    print_text_fmt_int(180, 148, "MISS %d", gSPTaskStats.deadlineMisses);
+#endif
+}
+
 // Draw the Profiler per frame. Toggle the mode if the player presses L while this
 // renderer is active.
 void draw_profiler(void) {
@@ -304,4 +375,5 @@ void draw_profiler(void) {
     } else {
         draw_profiler_mode_1();
     }
+    print_frame_pacing_stats();
 }
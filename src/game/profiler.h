@@ -46,6 +46,7 @@ void profiler_log_thread5_time(enum ProfilerGameEvent eventID);
 void profiler_log_thread4_time(void);
 void profiler_log_gfx_time(enum ProfilerGfxEvent eventID);
 void profiler_log_vblank_time(void);
+void profiler_log_present(void);
 void draw_profiler(void);
 
 #endif // PROFILER_H
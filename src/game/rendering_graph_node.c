@@ -6,6 +6,7 @@
 #include "gfx_dimensions.h"
 #include "main.h"
 #include "memory.h"
+#include "particle_system.h"
 #include "print.h"
 #include "rendering_graph_node.h"
 #include "shadow.h"
@@ -129,6 +130,328 @@ u16 gAreaUpdateCounter = 0;
 LookAt lookAt;
 #endif
 
+#ifdef FRUSTUM_CULLING
+/**
+ * The planes of the current perspective's view frustum, in camera space. The
+ * side planes pass through the camera, so each one is given by the sine and
+ * cosine of the angle between it and the view direction.
+ */
+struct ViewFrustum {
+    f32 sinHalfFovX;
+    f32 cosHalfFovX;
+    f32 sinHalfFovY;
+    f32 cosHalfFovY;
+    f32 near;
+    f32 far;
+};
+
+static struct ViewFrustum sViewFrustum;
+
+/**
+ * Set up sViewFrustum for a perspective node. fov is the vertical field of
+ * view, as passed to guPerspective.
+ */
+static void set_view_frustum(struct GraphNodePerspective *node, f32 aspect) {
+    s16 halfFov = (node->fov / 2.0f + 1.0f) * 32768.0f / 180.0f + 0.5f;
+    f32 tanHalfFovX;
+
+    sViewFrustum.sinHalfFovY = sins(halfFov);
+    sViewFrustum.cosHalfFovY = coss(halfFov);
+
+    tanHalfFovX = sViewFrustum.sinHalfFovY / sViewFrustum.cosHalfFovY * aspect;
+    sViewFrustum.cosHalfFovX = 1.0f / sqrtf(1.0f + tanHalfFovX * tanHalfFovX);
+    sViewFrustum.sinHalfFovX = tanHalfFovX * sViewFrustum.cosHalfFovX;
+
+    sViewFrustum.near = node->near;
+    sViewFrustum.far = node->far;
+}
+
+/**
+ * Return whether a sphere in camera space is inside or touching the left,
+ * right, top and bottom planes of the view frustum.
+ */
+static s32 sphere_is_within_frustum_sides(f32 x, f32 y, f32 z, f32 radius) {
+    f32 sideX = z * sViewFrustum.sinHalfFovX;
+    f32 sideY = z * sViewFrustum.sinHalfFovY;
+
+    if (x * sViewFrustum.cosHalfFovX + sideX > radius) {
+        return FALSE;
+    }
+    if (-x * sViewFrustum.cosHalfFovX + sideX > radius) {
+        return FALSE;
+    }
+    if (y * sViewFrustum.cosHalfFovY + sideY > radius) {
+        return FALSE;
+    }
+    if (-y * sViewFrustum.cosHalfFovY + sideY > radius) {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * Return whether a display list node's bounding sphere is in view, given the
+ * matrix its display list will be drawn with.
+ */
+static s32 display_list_is_in_view(struct GraphNodeDisplayList *node, Mat4 matrix) {
+    f32 x = node->cullCenter[0];
+    f32 y = node->cullCenter[1];
+    f32 z = node->cullCenter[2];
+    f32 viewZ;
+    f32 scaleSq = 0.0f;
+    f32 rowSq;
+    f32 radius;
+    s32 i;
+
+    // Not bounded, or not drawn with a perspective camera
+    if (node->cullRadius == 0 || gCurGraphNodeCamFrustum == NULL) {
+        return TRUE;
+    }
+
+    // The sphere grows with the largest scale in the matrix
+    for (i = 0; i < 3; i++) {
+        rowSq = matrix[i][0] * matrix[i][0] + matrix[i][1] * matrix[i][1] + matrix[i][2] * matrix[i][2];
+        if (rowSq > scaleSq) {
+            scaleSq = rowSq;
+        }
+    }
+    radius = node->cullRadius * sqrtf(scaleSq);
+
+    // Transform the center to camera space, checking the near and far planes
+    // before working out the rest
+    viewZ = x * matrix[0][2] + y * matrix[1][2] + z * matrix[2][2] + matrix[3][2];
+    if (viewZ - radius > -sViewFrustum.near || viewZ + radius < -sViewFrustum.far) {
+        return FALSE;
+    }
+
+    return sphere_is_within_frustum_sides(
+        x * matrix[0][0] + y * matrix[1][0] + z * matrix[2][0] + matrix[3][0],
+        x * matrix[0][1] + y * matrix[1][1] + z * matrix[2][1] + matrix[3][1], viewZ, radius);
+}
+#endif
+
+/**
+ * The number of RDP pipeline syncs the master lists caused this frame: the
+ * ones emitted by geo_process_master_list_sub, plus one for every pair of
+ * consecutive display lists in a layer that use a different texture or
+ * combiner. gMasterListUnsortedPipeSyncs is the same count for the order the
+ * display lists were appended in, for comparison.
+ */
+s32 gMasterListPipeSyncs;
+s32 gMasterListUnsortedPipeSyncs;
+
+#ifdef MASTER_LIST_SORTING
+// How many commands to look at when finding a display list's sort keys
+#define DISPLAY_LIST_SCAN_LENGTH 32
+
+/**
+ * Find the first texture image and color combiner set by a display list,
+ * following one level of nested display lists. Also mark display lists that
+ * end without drawing anything, like the ones geo_update_layer_transparency
+ * makes to set the environment color: the display lists after them depend on
+ * the state they set, so they must not be reordered.
+ */
+static void get_display_list_sort_keys(struct DisplayListNode *listNode) {
+    Gfx *dl = segmented_to_virtual(listNode->displayList);
+    Gfx *caller = NULL;
+    s32 i;
+
+    listNode->textureKey = 0;
+    listNode->combineKey = 0;
+    listNode->stateOnly = FALSE;
+
+    for (i = 0; i < DISPLAY_LIST_SCAN_LENGTH; i++, dl++) {
+        switch ((u8) (dl->words.w0 >> 24)) {
+            case G_SETTIMG:
+                if (listNode->textureKey == 0) {
+                    listNode->textureKey = dl->words.w1;
+                }
+                break;
+
+            case G_SETCOMBINE:
+                if (listNode->combineKey == 0) {
+                    listNode->combineKey = dl->words.w0 ^ dl->words.w1;
+                }
+                break;
+
+            case G_DL:
+                if (caller != NULL) {
+                    // Too deep to follow
+                    return;
+                }
+                // gSPBranchList doesn't return, so only gSPDisplayList has
+                // somewhere to come back to
+                if (((dl->words.w0 >> 16) & 0xFF) == G_DL_PUSH) {
+                    caller = dl;
+                }
+                dl = (Gfx *) segmented_to_virtual((void *) (uintptr_t) dl->words.w1) - 1;
+                break;
+
+            case (u8) G_ENDDL:
+                if (caller == NULL) {
+                    listNode->stateOnly = TRUE;
+                    return;
+                }
+                dl = caller;
+                caller = NULL;
+                break;
+
+            case G_VTX:
+            case G_TEXRECT:
+            case G_FILLRECT:
+                // Drawing has started, so the first state is known
+                return;
+        }
+    }
+}
+
+/**
+ * Return whether switching from one display list to the next costs an RDP
+ * pipeline sync for a texture or combiner change.
+ */
+static s32 display_lists_need_sync(struct DisplayListNode *a, struct DisplayListNode *b) {
+    return a->textureKey != b->textureKey || a->combineKey != b->combineKey;
+}
+
+/**
+ * Return whether a should be drawn before b in a sorted layer.
+ */
+static s32 display_list_sorts_before(struct DisplayListNode *a, struct DisplayListNode *b) {
+    if (a->textureKey != b->textureKey) {
+        return a->textureKey < b->textureKey;
+    }
+
+    return a->combineKey <= b->combineKey;
+}
+
+/**
+ * Stable merge sort of a list of display list nodes by texture, then combiner.
+ * Return the new head of the list.
+ */
+static struct DisplayListNode *sort_display_list_nodes(struct DisplayListNode *head) {
+    struct DisplayListNode *slow;
+    struct DisplayListNode *fast;
+    struct DisplayListNode *second;
+    struct DisplayListNode merged;
+    struct DisplayListNode *tail = &merged;
+
+    if (head == NULL || head->next == NULL) {
+        return head;
+    }
+
+    // Split the list in half
+    slow = head;
+    fast = head->next;
+    while (fast != NULL && fast->next != NULL) {
+        slow = slow->next;
+        fast = fast->next->next;
+    }
+    second = slow->next;
+    slow->next = NULL;
+
+    head = sort_display_list_nodes(head);
+    second = sort_display_list_nodes(second);
+
+    while (head != NULL && second != NULL) {
+        if (display_list_sorts_before(head, second)) {
+            tail->next = head;
+            head = head->next;
+        } else {
+            tail->next = second;
+            second = second->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = (head != NULL) ? head : second;
+
+    return merged.next;
+}
+
+/**
+ * Pin the display lists of a layer that draw without setting a texture or a
+ * combiner of their own, like the parts of Mario's model after the first one.
+ * They draw with the state left by the display lists before them, so they are
+ * pinned together with every display list back to the last one that sets both.
+ */
+static void pin_inheriting_display_lists(struct DisplayListNode *head) {
+    struct DisplayListNode *lastSetter = head;
+    struct DisplayListNode *currList;
+    struct DisplayListNode *pin;
+
+    for (currList = head; currList != NULL; currList = currList->next) {
+        currList->pinned = FALSE;
+        if (currList->stateOnly) {
+            continue;
+        }
+        if (currList->textureKey == 0 || currList->combineKey == 0) {
+            for (pin = lastSetter; pin != currList; pin = pin->next) {
+                pin->pinned = TRUE;
+            }
+            currList->pinned = TRUE;
+        }
+        lastSetter = currList;
+    }
+}
+
+/**
+ * Sort a master list layer by texture and combiner. Display lists that only
+ * set state or that inherit it stay in place, and only the runs between them
+ * are sorted, so that the display lists that depend on state set by others
+ * still come after them.
+ */
+static void sort_master_list_layer(struct GraphNodeMasterList *node, s32 layer) {
+    struct DisplayListNode **link = &node->listHeads[layer];
+    struct DisplayListNode *runHead;
+    struct DisplayListNode *runEnd;
+    struct DisplayListNode *barrier;
+
+    pin_inheriting_display_lists(node->listHeads[layer]);
+
+    while (*link != NULL) {
+        // Find the run up to the next display list that must keep its place
+        runHead = *link;
+        runEnd = NULL;
+        barrier = runHead;
+        while (barrier != NULL && !barrier->stateOnly && !barrier->pinned) {
+            runEnd = barrier;
+            barrier = barrier->next;
+        }
+
+        if (runEnd != NULL) {
+            runEnd->next = NULL;
+            *link = sort_display_list_nodes(runHead);
+            while (*link != NULL) {
+                link = &(*link)->next;
+            }
+            *link = barrier;
+        }
+
+        if (barrier == NULL) {
+            break;
+        }
+        link = &barrier->next;
+    }
+}
+
+/**
+ * Count the pipeline syncs caused by changes of state between the display
+ * lists of a layer.
+ */
+static s32 count_master_list_layer_syncs(struct DisplayListNode *currList) {
+    s32 count = 0;
+
+    while (currList != NULL && currList->next != NULL) {
+        if (display_lists_need_sync(currList, currList->next)) {
+            count++;
+        }
+        currList = currList->next;
+    }
+
+    return count;
+}
+#endif
+
 /**
  * Process a master list node.
  */
@@ -150,9 +473,28 @@ static void geo_process_master_list_sub(struct GraphNodeMasterList *node) {
     if (enableZBuffer != 0) {
         gDPPipeSync(gDisplayListHead++);
         gSPSetGeometryMode(gDisplayListHead++, G_ZBUFFER);
+        gMasterListPipeSyncs += 2;
+        gMasterListUnsortedPipeSyncs += 2;
     }
 
     for (i = 0; i < GFX_NUM_MASTER_LISTS; i++) {
+#ifdef MASTER_LIST_SORTING
+        // Opaque layers are drawn with the z-buffer, so their order only
+        // matters for display lists that set or inherit state from others.
+        // Translucent layers blend, so they keep the order they were appended
+        // in, which is the order the scene graph was traversed in.
+        if (node->listHeads[i] != NULL) {
+            s32 syncs = count_master_list_layer_syncs(node->listHeads[i]);
+
+            gMasterListUnsortedPipeSyncs += syncs;
+            if (enableZBuffer != 0 && i >= LAYER_OPAQUE && i <= LAYER_ALPHA) {
+                sort_master_list_layer(node, i);
+                syncs = count_master_list_layer_syncs(node->listHeads[i]);
+            }
+            gMasterListPipeSyncs += syncs;
+        }
+#endif
+
         if ((currList = node->listHeads[i]) != NULL) {
             gDPSetRenderMode(gDisplayListHead++, modeList->modes[i], mode2List->modes[i]);
             while (currList != NULL) {
@@ -186,6 +528,9 @@ static void geo_append_display_list(void *displayList, s16 layer) {
         listNode->transform = gMatStackFixed[gMatStackIndex];
         listNode->displayList = displayList;
         listNode->next = 0;
+#ifdef MASTER_LIST_SORTING
+        get_display_list_sort_keys(listNode);
+#endif
         if (gCurGraphNodeMasterList->listHeads[layer] == 0) {
             gCurGraphNodeMasterList->listHeads[layer] = listNode;
         } else {
@@ -253,6 +598,9 @@ static void geo_process_perspective(struct GraphNodePerspective *node) {
                   G_MTX_PROJECTION | G_MTX_LOAD | G_MTX_NOPUSH);
 
         gCurGraphNodeCamFrustum = node;
+#ifdef FRUSTUM_CULLING
+        set_view_frustum(node, aspect);
+#endif
         geo_process_node_and_siblings(node->fnNode.node.children);
         gCurGraphNodeCamFrustum = NULL;
     }
@@ -302,13 +650,246 @@ static void geo_process_switch(struct GraphNodeSwitchCase *node) {
     }
 }
 
+/**
+ * Number of fixed point matrices converted and reused this frame.
+ */
+s32 gMtxCacheBuilt;
+s32 gMtxCacheReused;
+
+#ifdef FAST_BILLBOARD_MTX
+/**
+ * Whether the matrix on top of the stack is a billboard matrix, set by
+ * geo_convert_billboard_transform for the conversion it wraps.
+ */
+static s8 sConvertBillboard = FALSE;
+#endif
+
+/**
+ * Convert the float matrix on top of the stack to fixed point matrix 'mtx'.
+ */
+static void geo_mtxf_to_mtx(Mtx *mtx) {
+#ifdef FAST_BILLBOARD_MTX
+    if (sConvertBillboard) {
+        mtxf_billboard_to_mtx(mtx, gMatStack[gMatStackIndex]);
+        return;
+    }
+#endif
+    mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
+}
+
+#ifdef MTX_CACHE
+#define MTX_CACHE_KEY_SIZE 11
+
+/**
+ * A transform remembered from an earlier frame. The transform is reused when
+ * the same node is processed on top of a parent matrix with the same version
+ * and with the same local parameters (the key).
+ * The fixed point matrix is double buffered, and a buffer is only rewritten
+ * once the display lists of the frames that used it have been drawn.
+ */
+struct MtxCacheEntry {
+    const void *owner;
+    const void *context;
+    s32 parentVersion;
+    s32 version;
+    f32 key[MTX_CACHE_KEY_SIZE];
+    s32 keySize;
+    Mat4 mtxf;
+    Mtx mtx[2];
+    u32 mtxFrame[2];
+    s8 curMtx;
+    s8 mtxValid;
+};
+
+/**
+ * The cache, allocated from the main pool for each level by alloc_mtx_cache.
+ * Transforms aren't cached while it is NULL.
+ */
+static struct MtxCacheEntry *sMtxCache = NULL;
+
+/**
+ * The version of each matrix on gMatStack. Matrices with the same version
+ * are equal. Version 1 is the identity matrix at the bottom of the stack.
+ */
+static s32 sMatStackVersion[32];
+static s32 sNextMtxVersion = 2;
+
+/**
+ * The cache entry of each matrix on gMatStack, or NULL if it was not cached.
+ */
+static struct MtxCacheEntry *sMatStackEntry[32];
+
+static struct MtxCacheEntry *sMtxCacheMiss = NULL;
+static u32 sMtxCacheFrame = 0;
+
+/**
+ * Allocate an empty matrix cache from the main pool. Called on level load after
+ * the pool state is pushed, so that the cache is freed along with the level.
+ */
+void alloc_mtx_cache(void) {
+    sMtxCache = main_pool_alloc(MTX_CACHE_SIZE * sizeof(struct MtxCacheEntry), MEMORY_POOL_LEFT);
+    if (sMtxCache != NULL) {
+        bzero(sMtxCache, MTX_CACHE_SIZE * sizeof(struct MtxCacheEntry));
+    }
+}
+
+/**
+ * Stop using the matrix cache before the level's memory is freed.
+ */
+void free_mtx_cache(void) {
+    sMtxCache = NULL;
+    sMtxCacheMiss = NULL;
+}
+
+/**
+ * Give the matrix on top of the stack a new version, for transforms that are
+ * not cached.
+ */
+static void geo_new_transform_version(void) {
+    sMatStackVersion[gMatStackIndex] = sNextMtxVersion++;
+    sMatStackEntry[gMatStackIndex] = NULL;
+    gMatStackFixed[gMatStackIndex] = NULL;
+}
+
+/**
+ * Look up the transform of 'owner' on top of the current matrix. Nodes of
+ * shared models are told apart by the object they are drawn for. If it is
+ * cached, push the cached matrix on the stack and return TRUE. Otherwise
+ * return FALSE: the caller then builds the matrix in gMatStack[gMatStackIndex + 1],
+ * increments gMatStackIndex and calls geo_store_transform.
+ */
+static s32 geo_reuse_transform(const void *owner, f32 *key, s32 keySize) {
+    const void *context = gCurGraphNodeHeldObject != NULL ? (void *) gCurGraphNodeHeldObject
+                                                          : (void *) gCurGraphNodeObject;
+    u32 hash = (((u32) owner ^ ((u32) context << 7)) >> 2) * 0x9E3779B1;
+    struct MtxCacheEntry *entry;
+    s32 parentVersion = sMatStackVersion[gMatStackIndex];
+    s32 i;
+
+    if (sMtxCache == NULL) {
+        return FALSE;
+    }
+
+    entry = &sMtxCache[(hash >> 16) & (MTX_CACHE_SIZE - 1)];
+
+    if (entry->owner == owner && entry->context == context && entry->parentVersion == parentVersion
+        && entry->keySize == keySize) {
+        for (i = 0; i < keySize; i++) {
+            if (entry->key[i] != key[i]) {
+                break;
+            }
+        }
+        if (i == keySize) {
+            gMatStackIndex++;
+            mtxf_copy(gMatStack[gMatStackIndex], entry->mtxf);
+            sMatStackVersion[gMatStackIndex] = entry->version;
+            sMatStackEntry[gMatStackIndex] = entry;
+            gMatStackFixed[gMatStackIndex] = NULL;
+            return TRUE;
+        }
+    }
+
+    entry->owner = owner;
+    entry->context = context;
+    entry->parentVersion = parentVersion;
+    entry->version = 0;
+    entry->keySize = keySize;
+    for (i = 0; i < keySize; i++) {
+        entry->key[i] = key[i];
+    }
+    sMtxCacheMiss = entry;
+    return FALSE;
+}
+
+/**
+ * Store the matrix the caller just pushed after a cache miss.
+ */
+static void geo_store_transform(void) {
+    struct MtxCacheEntry *entry = sMtxCacheMiss;
+
+    if (entry == NULL) {
+        geo_new_transform_version();
+        return;
+    }
+
+    mtxf_copy(entry->mtxf, gMatStack[gMatStackIndex]);
+    entry->version = sNextMtxVersion++;
+    entry->mtxValid = FALSE;
+    sMatStackVersion[gMatStackIndex] = entry->version;
+    sMatStackEntry[gMatStackIndex] = entry;
+    gMatStackFixed[gMatStackIndex] = NULL;
+    sMtxCacheMiss = NULL;
+}
+
+/**
+ * Set the fixed point matrix for the matrix on top of the stack, reusing the
+ * one of its cache entry if it has been converted before.
+ */
+static void geo_convert_transform(void) {
+    struct MtxCacheEntry *entry = sMatStackEntry[gMatStackIndex];
+    Mtx *mtx;
+    s32 next;
+
+    if (gMatStackFixed[gMatStackIndex] != NULL) {
+        return;
+    }
+
+    if (entry != NULL && entry->mtxValid) {
+        entry->mtxFrame[entry->curMtx] = sMtxCacheFrame;
+        gMatStackFixed[gMatStackIndex] = &entry->mtx[entry->curMtx];
+        gMtxCacheReused++;
+        return;
+    }
+
+    // The other buffer may still be read by the RSP for the previous frame
+    next = entry != NULL ? entry->curMtx ^ 1 : 0;
+    if (entry != NULL && sMtxCacheFrame - entry->mtxFrame[next] >= 2) {
+        entry->curMtx = next;
+        entry->mtxValid = TRUE;
+        entry->mtxFrame[next] = sMtxCacheFrame;
+        mtx = &entry->mtx[next];
+    } else {
+        mtx = alloc_display_list(sizeof(*mtx));
+    }
+    geo_mtxf_to_mtx(mtx);
+    gMatStackFixed[gMatStackIndex] = mtx;
+    gMtxCacheBuilt++;
+}
+#else
+#define geo_new_transform_version()
+#define geo_reuse_transform(owner, key, keySize) FALSE
+#define geo_store_transform()
+
+static void geo_convert_transform(void) {
+    Mtx *mtx = alloc_display_list(sizeof(*mtx));
+
+    geo_mtxf_to_mtx(mtx);
+    gMatStackFixed[gMatStackIndex] = mtx;
+    gMtxCacheBuilt++;
+}
+#endif
+
+#ifdef FAST_BILLBOARD_MTX
+/**
+ * Like geo_convert_transform, for a matrix built by mtxf_billboard and
+ * mtxf_scale_vec3f. Only its non-constant entries are converted.
+ */
+static void geo_convert_billboard_transform(void) {
+    sConvertBillboard = TRUE;
+    geo_convert_transform();
+    sConvertBillboard = FALSE;
+}
+#else
+#define geo_convert_billboard_transform() geo_convert_transform()
+#endif
+
 /**
  * Process a camera node.
  */
 static void geo_process_camera(struct GraphNodeCamera *node) {
     Mat4 cameraTransform;
     Mtx *rollMtx = alloc_display_list(sizeof(*rollMtx));
-    Mtx *mtx = alloc_display_list(sizeof(*mtx));
+    f32 key[7];
 
     if (node->fnNode.func != NULL) {
         node->fnNode.func(GEO_CONTEXT_RENDER, &node->fnNode.node, gMatStack[gMatStackIndex]);
@@ -318,11 +899,16 @@ static void geo_process_camera(struct GraphNodeCamera *node) {
     gSPMatrix(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(rollMtx),
               G_MTX_PROJECTION | G_MTX_MUL | G_MTX_NOPUSH);
 
-    mtxf_lookat(cameraTransform, node->pos, node->focus, node->roll);
-    mtxf_mul(gMatStack[gMatStackIndex + 1], cameraTransform, gMatStack[gMatStackIndex]);
-    gMatStackIndex++;
-    mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
-    gMatStackFixed[gMatStackIndex] = mtx;
+    vec3f_copy(&key[0], node->pos);
+    vec3f_copy(&key[3], node->focus);
+    key[6] = node->roll;
+    if (!geo_reuse_transform(node, key, 7)) {
+        mtxf_lookat(cameraTransform, node->pos, node->focus, node->roll);
+        mtxf_mul(gMatStack[gMatStackIndex + 1], cameraTransform, gMatStack[gMatStackIndex]);
+        gMatStackIndex++;
+        geo_store_transform();
+    }
+    geo_convert_transform();
     if (node->fnNode.node.children != 0) {
         gCurGraphNodeCamera = node;
         node->matrixPtr = &gMatStack[gMatStackIndex];
@@ -341,14 +927,18 @@ static void geo_process_camera(struct GraphNodeCamera *node) {
 static void geo_process_translation_rotation(struct GraphNodeTranslationRotation *node) {
     Mat4 mtxf;
     Vec3f translation;
-    Mtx *mtx = alloc_display_list(sizeof(*mtx));
+    f32 key[6];
 
     vec3s_to_vec3f(translation, node->translation);
-    mtxf_rotate_zxy_and_translate(mtxf, translation, node->rotation);
-    mtxf_mul(gMatStack[gMatStackIndex + 1], mtxf, gMatStack[gMatStackIndex]);
-    gMatStackIndex++;
-    mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
-    gMatStackFixed[gMatStackIndex] = mtx;
+    vec3f_copy(&key[0], translation);
+    vec3s_to_vec3f(&key[3], node->rotation);
+    if (!geo_reuse_transform(node, key, 6)) {
+        mtxf_rotate_zxy_and_translate(mtxf, translation, node->rotation);
+        mtxf_mul(gMatStack[gMatStackIndex + 1], mtxf, gMatStack[gMatStackIndex]);
+        gMatStackIndex++;
+        geo_store_transform();
+    }
+    geo_convert_transform();
     if (node->displayList != NULL) {
         geo_append_display_list(node->displayList, node->node.flags >> 8);
     }
@@ -366,14 +956,15 @@ static void geo_process_translation_rotation(struct GraphNodeTranslationRotation
 static void geo_process_translation(struct GraphNodeTranslation *node) {
     Mat4 mtxf;
     Vec3f translation;
-    Mtx *mtx = alloc_display_list(sizeof(*mtx));
 
     vec3s_to_vec3f(translation, node->translation);
-    mtxf_rotate_zxy_and_translate(mtxf, translation, gVec3sZero);
-    mtxf_mul(gMatStack[gMatStackIndex + 1], mtxf, gMatStack[gMatStackIndex]);
-    gMatStackIndex++;
-    mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
-    gMatStackFixed[gMatStackIndex] = mtx;
+    if (!geo_reuse_transform(node, translation, 3)) {
+        mtxf_rotate_zxy_and_translate(mtxf, translation, gVec3sZero);
+        mtxf_mul(gMatStack[gMatStackIndex + 1], mtxf, gMatStack[gMatStackIndex]);
+        gMatStackIndex++;
+        geo_store_transform();
+    }
+    geo_convert_transform();
     if (node->displayList != NULL) {
         geo_append_display_list(node->displayList, node->node.flags >> 8);
     }
@@ -390,13 +981,16 @@ static void geo_process_translation(struct GraphNodeTranslation *node) {
  */
 static void geo_process_rotation(struct GraphNodeRotation *node) {
     Mat4 mtxf;
-    Mtx *mtx = alloc_display_list(sizeof(*mtx));
+    Vec3f key;
 
-    mtxf_rotate_zxy_and_translate(mtxf, gVec3fZero, node->rotation);
-    mtxf_mul(gMatStack[gMatStackIndex + 1], mtxf, gMatStack[gMatStackIndex]);
-    gMatStackIndex++;
-    mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
-    gMatStackFixed[gMatStackIndex] = mtx;
+    vec3s_to_vec3f(key, node->rotation);
+    if (!geo_reuse_transform(node, key, 3)) {
+        mtxf_rotate_zxy_and_translate(mtxf, gVec3fZero, node->rotation);
+        mtxf_mul(gMatStack[gMatStackIndex + 1], mtxf, gMatStack[gMatStackIndex]);
+        gMatStackIndex++;
+        geo_store_transform();
+    }
+    geo_convert_transform();
     if (node->displayList != NULL) {
         geo_append_display_list(node->displayList, node->node.flags >> 8);
     }
@@ -414,13 +1008,14 @@ static void geo_process_rotation(struct GraphNodeRotation *node) {
 static void geo_process_scale(struct GraphNodeScale *node) {
     UNUSED Mat4 transform;
     Vec3f scaleVec;
-    Mtx *mtx = alloc_display_list(sizeof(*mtx));
 
     vec3f_set(scaleVec, node->scale, node->scale, node->scale);
-    mtxf_scale_vec3f(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex], scaleVec);
-    gMatStackIndex++;
-    mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
-    gMatStackFixed[gMatStackIndex] = mtx;
+    if (!geo_reuse_transform(node, scaleVec, 1)) {
+        mtxf_scale_vec3f(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex], scaleVec);
+        gMatStackIndex++;
+        geo_store_transform();
+    }
+    geo_convert_transform();
     if (node->displayList != NULL) {
         geo_append_display_list(node->displayList, node->node.flags >> 8);
     }
@@ -438,9 +1033,9 @@ static void geo_process_scale(struct GraphNodeScale *node) {
  */
 static void geo_process_billboard(struct GraphNodeBillboard *node) {
     Vec3f translation;
-    Mtx *mtx = alloc_display_list(sizeof(*mtx));
 
     gMatStackIndex++;
+    geo_new_transform_version();
     vec3s_to_vec3f(translation, node->translation);
     mtxf_billboard(gMatStack[gMatStackIndex], gMatStack[gMatStackIndex - 1], translation,
                    gCurGraphNodeCamera->roll);
@@ -452,8 +1047,7 @@ static void geo_process_billboard(struct GraphNodeBillboard *node) {
                          gCurGraphNodeObject->scale);
     }
 
-    mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
-    gMatStackFixed[gMatStackIndex] = mtx;
+    geo_convert_billboard_transform();
 
     if (node->displayList != NULL) {
         geo_append_display_list(node->displayList, node->node.flags >> 8);
@@ -472,6 +1066,15 @@ static void geo_process_billboard(struct GraphNodeBillboard *node) {
  * parent node. It processes its children if it has them.
  */
 static void geo_process_display_list(struct GraphNodeDisplayList *node) {
+#ifdef FRUSTUM_CULLING
+    if (!display_list_is_in_view(node, gMatStack[gMatStackIndex])) {
+        // Out of view. Skip the children too if the sphere bounds them.
+        if (!node->cullSubtree && node->node.children != NULL) {
+            geo_process_node_and_siblings(node->node.children);
+        }
+        return;
+    }
+#endif
     if (node->displayList != NULL) {
         geo_append_display_list(node->displayList, node->node.flags >> 8);
     }
@@ -480,6 +1083,60 @@ static void geo_process_display_list(struct GraphNodeDisplayList *node) {
     }
 }
 
+#ifdef FLATTEN_STATIC_GEO
+/**
+ * Process a flattened subtree. Each of its transforms is multiplied onto the
+ * current matrix the first time a display list needs it, and the display lists
+ * are appended in the order the original subtree would have appended them.
+ */
+static void geo_process_flattened(struct GraphNodeFlattened *node) {
+    Mtx **mtxs = alloc_display_list(node->numMatrices * sizeof(Mtx *));
+    struct FlattenedDisplayList *flatList = node->displayLists;
+    s32 curMatrix = -1;
+    s32 i;
+
+    if (mtxs == NULL) {
+        return;
+    }
+
+    for (i = 0; i < node->numMatrices; i++) {
+        mtxs[i] = NULL;
+    }
+
+    // Display lists without a transform of their own use the current matrix
+    mtxf_copy(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex]);
+    gMatStackFixed[gMatStackIndex + 1] = gMatStackFixed[gMatStackIndex];
+    gMatStackIndex++;
+
+    for (i = 0; i < node->numDisplayLists; i++, flatList++) {
+        if (flatList->matrixIndex != curMatrix) {
+            curMatrix = flatList->matrixIndex;
+            if (curMatrix < 0) {
+                mtxf_copy(gMatStack[gMatStackIndex], gMatStack[gMatStackIndex - 1]);
+                gMatStackFixed[gMatStackIndex] = gMatStackFixed[gMatStackIndex - 1];
+            } else {
+                mtxf_mul(gMatStack[gMatStackIndex], node->matrices[curMatrix], gMatStack[gMatStackIndex - 1]);
+                if (mtxs[curMatrix] == NULL) {
+                    mtxs[curMatrix] = alloc_display_list(sizeof(Mtx));
+                    mtxf_to_mtx(mtxs[curMatrix], gMatStack[gMatStackIndex]);
+                }
+                gMatStackFixed[gMatStackIndex] = mtxs[curMatrix];
+            }
+        }
+
+#ifdef FRUSTUM_CULLING
+        if (flatList->cullNode != NULL
+            && !display_list_is_in_view(flatList->cullNode, gMatStack[gMatStackIndex])) {
+            continue;
+        }
+#endif
+        geo_append_display_list(flatList->displayList, flatList->layer);
+    }
+
+    gMatStackIndex--;
+}
+#endif
+
 /**
  * Process a generated list. Instead of storing a pointer to a display list,
  * the list is generated on the fly by a function.
@@ -536,18 +1193,147 @@ static void geo_process_background(struct GraphNodeBackground *node) {
     }
 }
 
+#ifdef ANIM_DECODE_CACHE
 /**
- * Render an animated part. The current animation state is not part of the node
- * but set in global variables. If an animated part is skipped, everything afterwards desyncs.
+ * The decoded values of one frame of an animation. Objects sharing an
+ * animation on the same frame (a crowd of goombas) decode each joint once and
+ * look it up afterwards. Joints are decoded the first time any object needs
+ * them, in the order the animated parts are processed.
  */
-static void geo_process_animated_part(struct GraphNodeAnimatedPart *node) {
-    Mat4 matrix;
-    Vec3s rotation;
-    Vec3f translation;
-    Mtx *matrixPtr = alloc_display_list(sizeof(*matrixPtr));
+struct AnimDecodeEntry {
+    struct Animation *anim;
+    u16 *index;
+    s16 *values;
+    s16 frame;
+    s16 numJoints;
+    Vec3s translation;
+    Vec3s rotations[ANIM_DECODE_MAX_JOINTS];
+};
 
-    vec3s_copy(rotation, gVec3sZero);
-    vec3f_set(translation, node->translation[0], node->translation[1], node->translation[2]);
+// Entries are allocated from the display list heap, so they only live for one frame
+static struct AnimDecodeEntry *sAnimDecodeCache[ANIM_DECODE_CACHE_SIZE];
+static struct AnimDecodeEntry *sCurAnimDecode = NULL;
+static struct AnimDecodeEntry *sTempAnimDecode = NULL;
+
+/**
+ * Forget the decoded animations of the previous frame.
+ */
+static void clear_anim_decode_cache(void) {
+    s32 i;
+
+    for (i = 0; i < ANIM_DECODE_CACHE_SIZE; i++) {
+        sAnimDecodeCache[i] = NULL;
+    }
+    sCurAnimDecode = NULL;
+}
+
+/**
+ * Find the decode cache entry for the current frame of an animation, or start
+ * a new one. Returns NULL if there is no memory left for it.
+ */
+static struct AnimDecodeEntry *get_anim_decode_entry(struct Animation *anim, s16 frame) {
+    u32 hash = ((u32) anim >> 2) * 0x9E3779B1 + frame * 0x85EBCA6B;
+    struct AnimDecodeEntry **slot = &sAnimDecodeCache[(hash >> 16) & (ANIM_DECODE_CACHE_SIZE - 1)];
+    struct AnimDecodeEntry *entry = *slot;
+
+    if (entry != NULL && entry->anim == anim && entry->frame == frame) {
+        return entry;
+    }
+
+    entry = alloc_only_pool_alloc(gDisplayListHeap, sizeof(*entry));
+    if (entry != NULL) {
+        entry->anim = anim;
+        entry->index = gCurrAnimAttribute;
+        entry->values = gCurrAnimData;
+        entry->frame = frame;
+        entry->numJoints = 0;
+        *slot = entry;
+    }
+    return entry;
+}
+
+/**
+ * Decode the next joint of the current animation into the cache entry.
+ * The attribute walk is the same as the uncached one in geo_process_animated_part.
+ */
+static void decode_anim_joint(struct AnimDecodeEntry *entry) {
+    u16 *attribute;
+    s16 *rotation = entry->rotations[entry->numJoints];
+
+    if (entry->numJoints == 0) {
+        u8 animType = gCurrAnimType;
+
+        attribute = entry->index;
+        vec3s_copy(entry->translation, gVec3sZero);
+        if (animType == ANIM_TYPE_TRANSLATION) {
+            entry->translation[0] = entry->values[retrieve_animation_index(entry->frame, &attribute)];
+            entry->translation[1] = entry->values[retrieve_animation_index(entry->frame, &attribute)];
+            entry->translation[2] = entry->values[retrieve_animation_index(entry->frame, &attribute)];
+        } else if (animType == ANIM_TYPE_LATERAL_TRANSLATION) {
+            entry->translation[0] = entry->values[retrieve_animation_index(entry->frame, &attribute)];
+            attribute += 2;
+            entry->translation[2] = entry->values[retrieve_animation_index(entry->frame, &attribute)];
+        } else if (animType == ANIM_TYPE_VERTICAL_TRANSLATION) {
+            attribute += 2;
+            entry->translation[1] = entry->values[retrieve_animation_index(entry->frame, &attribute)];
+            attribute += 2;
+        } else {
+            attribute += 6;
+        }
+    } else {
+        attribute = entry->index + 6 + entry->numJoints * 6;
+    }
+
+    rotation[0] = entry->values[retrieve_animation_index(entry->frame, &attribute)];
+    rotation[1] = entry->values[retrieve_animation_index(entry->frame, &attribute)];
+    rotation[2] = entry->values[retrieve_animation_index(entry->frame, &attribute)];
+    entry->numJoints++;
+}
+
+/**
+ * Look up the animated translation and rotation of the next animated part in
+ * the decode cache, and advance the animation state past it. Returns FALSE if
+ * the part can't be served from the cache and has to be decoded directly.
+ */
+static s32 geo_get_cached_anim_joint(Vec3f translation, Vec3s rotation) {
+    struct AnimDecodeEntry *entry = sCurAnimDecode;
+    s32 joint;
+
+    if (entry == NULL || gCurrAnimType == ANIM_TYPE_NONE) {
+        return FALSE;
+    }
+
+    if (gCurrAnimType == ANIM_TYPE_ROTATION) {
+        joint = (gCurrAnimAttribute - entry->index - 6) / 6;
+    } else {
+        joint = 0;
+    }
+    if (joint >= ANIM_DECODE_MAX_JOINTS || joint > entry->numJoints) {
+        return FALSE;
+    }
+    if (joint == entry->numJoints) {
+        decode_anim_joint(entry);
+    }
+
+    if (joint == 0) {
+        translation[0] += entry->translation[0] * gCurrAnimTranslationMultiplier;
+        translation[1] += entry->translation[1] * gCurrAnimTranslationMultiplier;
+        translation[2] += entry->translation[2] * gCurrAnimTranslationMultiplier;
+        gCurrAnimAttribute = entry->index + 6;
+        gCurrAnimType = ANIM_TYPE_ROTATION;
+    }
+    vec3s_copy(rotation, entry->rotations[joint]);
+    gCurrAnimAttribute += 6;
+    return TRUE;
+}
+#endif
+
+/**
+ * Decode the animated translation and rotation of the next animated part
+ * straight from the animation's index and value tables, and advance the
+ * animation state past it.
+ */
+static void geo_decode_anim_joint(Vec3f translation, Vec3s rotation) {
     if (gCurrAnimType == ANIM_TYPE_TRANSLATION) {
         translation[0] += gCurrAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)]
                           * gCurrAnimTranslationMultiplier;
@@ -586,11 +1372,36 @@ static void geo_process_animated_part(struct GraphNodeAnimatedPart *node) {
         rotation[1] = gCurrAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)];
         rotation[2] = gCurrAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)];
     }
-    mtxf_rotate_xyz_and_translate(matrix, translation, rotation);
-    mtxf_mul(gMatStack[gMatStackIndex + 1], matrix, gMatStack[gMatStackIndex]);
-    gMatStackIndex++;
-    mtxf_to_mtx(matrixPtr, gMatStack[gMatStackIndex]);
-    gMatStackFixed[gMatStackIndex] = matrixPtr;
+}
+
+/**
+ * Render an animated part. The current animation state is not part of the node
+ * but set in global variables. If an animated part is skipped, everything afterwards desyncs.
+ */
+static void geo_process_animated_part(struct GraphNodeAnimatedPart *node) {
+    Mat4 matrix;
+    Vec3s rotation;
+    Vec3f translation;
+    f32 key[6];
+
+    vec3s_copy(rotation, gVec3sZero);
+    vec3f_set(translation, node->translation[0], node->translation[1], node->translation[2]);
+#ifdef ANIM_DECODE_CACHE
+    if (!geo_get_cached_anim_joint(translation, rotation)) {
+        geo_decode_anim_joint(translation, rotation);
+    }
+#else
+    geo_decode_anim_joint(translation, rotation);
+#endif
+    vec3f_copy(&key[0], translation);
+    vec3s_to_vec3f(&key[3], rotation);
+    if (!geo_reuse_transform(node, key, 6)) {
+        mtxf_rotate_xyz_and_translate(matrix, translation, rotation);
+        mtxf_mul(gMatStack[gMatStackIndex + 1], matrix, gMatStack[gMatStackIndex]);
+        gMatStackIndex++;
+        geo_store_transform();
+    }
+    geo_convert_transform();
     if (node->displayList != NULL) {
         geo_append_display_list(node->displayList, node->node.flags >> 8);
     }
@@ -631,6 +1442,9 @@ void geo_set_animation_globals(struct AnimInfo *node, s32 hasAnimation) {
     } else {
         gCurrAnimTranslationMultiplier = (f32) node->animYTrans / (f32) anim->animYTransDivisor;
     }
+#ifdef ANIM_DECODE_CACHE
+    sCurAnimDecode = get_anim_decode_entry(anim, gCurrAnimFrame);
+#endif
 }
 
 // TO-DO: clean this up and fix warnings
@@ -689,7 +1503,9 @@ static void geo_process_shadow(struct GraphNodeShadow *node) {
  * This is known as frustum culling.
  * It checks whether the object is far away, very close / behind the camera,
  * or horizontally out of view. It does not check whether it is vertically
- * out of view. It assumes a sphere of 300 units around the object's position
+ * out of view, unless FRUSTUM_CULLING is defined, in which case the object
+ * is checked against all four side planes of the frustum with the aspect ratio
+ * accounted for. It assumes a sphere of 300 units around the object's position
  * unless the object has a culling radius node that specifies otherwise.
  *
  * The matrix parameter should be the top of the matrix stack, which is the
@@ -717,9 +1533,11 @@ static void geo_process_shadow(struct GraphNodeShadow *node) {
  */
 static s32 obj_is_in_view(struct GraphNodeObject *node, Mat4 matrix) {
     s16 cullingRadius;
+#ifndef FRUSTUM_CULLING
     s16 halfFov; // half of the fov in in-game angle units instead of degrees
-    struct GraphNode *geo;
     f32 hScreenEdge;
+#endif
+    struct GraphNode *geo;
 
     if (node->node.flags & GRAPH_RENDER_INVISIBLE) {
         return FALSE;
@@ -727,6 +1545,7 @@ static s32 obj_is_in_view(struct GraphNodeObject *node, Mat4 matrix) {
 
     geo = node->sharedChild;
 
+#ifndef FRUSTUM_CULLING
     // ! @bug The aspect ratio is not accounted for. When the fov value is 45,
     // the horizontal effective fov is actually 60 degrees, so you can see objects
     // visibly pop in or out at the edge of the screen.
@@ -741,6 +1560,7 @@ static s32 obj_is_in_view(struct GraphNodeObject *node, Mat4 matrix) {
     // This multiplication should really be performed on 4:3 as well,
     // but the issue will be more apparent on widescreen.
     hScreenEdge *= GFX_DIMENSIONS_ASPECT_RATIO;
+#endif
 #endif
 
     if (geo != NULL && geo->type == GRAPH_NODE_TYPE_CULLING_RADIUS) {
@@ -763,6 +1583,10 @@ static s32 obj_is_in_view(struct GraphNodeObject *node, Mat4 matrix) {
         return FALSE;
     }
 
+#ifdef FRUSTUM_CULLING
+    // Check whether the object is within the side planes of the frustum
+    return sphere_is_within_frustum_sides(matrix[3][0], matrix[3][1], matrix[3][2], cullingRadius);
+#else
     // Check whether the object is horizontally in view
     if (matrix[3][0] > hScreenEdge + cullingRadius) {
         return FALSE;
@@ -771,6 +1595,7 @@ static s32 obj_is_in_view(struct GraphNodeObject *node, Mat4 matrix) {
         return FALSE;
     }
     return TRUE;
+#endif
 }
 
 /**
@@ -779,22 +1604,47 @@ static s32 obj_is_in_view(struct GraphNodeObject *node, Mat4 matrix) {
 static void geo_process_object(struct Object *node) {
     Mat4 mtxf;
     s32 hasAnimation = (node->header.gfx.node.flags & GRAPH_RENDER_HAS_ANIMATION) != 0;
+    s32 isBillboard = FALSE;
+    f32 key[11];
 
     if (node->header.gfx.areaIndex == gCurGraphNodeRoot->areaIndex) {
+        // A throw matrix is set by the object's behavior each frame, so it isn't cached
         if (node->header.gfx.throwMatrix != NULL) {
             mtxf_mul(gMatStack[gMatStackIndex + 1], *node->header.gfx.throwMatrix,
                      gMatStack[gMatStackIndex]);
-        } else if (node->header.gfx.node.flags & GRAPH_RENDER_BILLBOARD) {
-            mtxf_billboard(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex],
-                           node->header.gfx.pos, gCurGraphNodeCamera->roll);
+            mtxf_scale_vec3f(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex + 1],
+                             node->header.gfx.scale);
+            gMatStackIndex++;
+            geo_new_transform_version();
         } else {
-            mtxf_rotate_zxy_and_translate(mtxf, node->header.gfx.pos, node->header.gfx.angle);
-            mtxf_mul(gMatStack[gMatStackIndex + 1], mtxf, gMatStack[gMatStackIndex]);
+            isBillboard = (node->header.gfx.node.flags & GRAPH_RENDER_BILLBOARD) != 0;
+            vec3f_copy(&key[0], node->header.gfx.pos);
+            vec3s_to_vec3f(&key[3], node->header.gfx.angle);
+            vec3f_copy(&key[6], node->header.gfx.scale);
+            if (node->header.gfx.node.flags & GRAPH_RENDER_BILLBOARD) {
+                key[9] = TRUE;
+                key[10] = gCurGraphNodeCamera->roll;
+            } else {
+                key[9] = FALSE;
+                key[10] = 0.0f;
+            }
+            if (!geo_reuse_transform(node, key, 11)) {
+                if (node->header.gfx.node.flags & GRAPH_RENDER_BILLBOARD) {
+                    mtxf_billboard(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex],
+                                   node->header.gfx.pos, gCurGraphNodeCamera->roll);
+                } else {
+                    mtxf_rotate_zxy_and_translate(mtxf, node->header.gfx.pos,
+                                                  node->header.gfx.angle);
+                    mtxf_mul(gMatStack[gMatStackIndex + 1], mtxf, gMatStack[gMatStackIndex]);
+                }
+                mtxf_scale_vec3f(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex + 1],
+                                 node->header.gfx.scale);
+                gMatStackIndex++;
+                geo_store_transform();
+            }
         }
 
-        mtxf_scale_vec3f(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex + 1],
-                         node->header.gfx.scale);
-        node->header.gfx.throwMatrix = &gMatStack[++gMatStackIndex];
+        node->header.gfx.throwMatrix = &gMatStack[gMatStackIndex];
         node->header.gfx.cameraToObject[0] = gMatStack[gMatStackIndex][3][0];
         node->header.gfx.cameraToObject[1] = gMatStack[gMatStackIndex][3][1];
         node->header.gfx.cameraToObject[2] = gMatStack[gMatStackIndex][3][2];
@@ -804,10 +1654,11 @@ static void geo_process_object(struct Object *node) {
             geo_set_animation_globals(&node->header.gfx.animInfo, hasAnimation);
         }
         if (obj_is_in_view(&node->header.gfx, gMatStack[gMatStackIndex])) {
-            Mtx *mtx = alloc_display_list(sizeof(*mtx));
-
-            mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
-            gMatStackFixed[gMatStackIndex] = mtx;
+            if (isBillboard) {
+                geo_convert_billboard_transform();
+            } else {
+                geo_convert_transform();
+            }
             if (node->header.gfx.sharedChild != NULL) {
                 gCurGraphNodeObject = (struct GraphNodeObject *) node;
                 node->header.gfx.sharedChild->parent = &node->header.gfx.node;
@@ -826,10 +1677,31 @@ static void geo_process_object(struct Object *node) {
     }
 }
 
+/**
+ * Draw every lightweight particle. Each layer's particles are batched into a
+ * single display list, which loads the particles' own matrices.
+ */
+static void geo_process_particles(void) {
+    Gfx *layerLists[GFX_NUM_MASTER_LISTS];
+    s32 i;
+
+    if (gCurGraphNodeCamera == NULL || gParticles == NULL || gParticles->count == 0) {
+        return;
+    }
+
+    render_particles(layerLists, gMatStack[gMatStackIndex], gCurGraphNodeCamera->roll);
+    for (i = 0; i < GFX_NUM_MASTER_LISTS; i++) {
+        if (layerLists[i] != NULL) {
+            geo_append_display_list((void *) VIRTUAL_TO_PHYSICAL(layerLists[i]), i);
+        }
+    }
+}
+
 /**
  * Process an object parent node. Temporarily assigns itself as the parent of
  * the subtree rooted at 'sharedChild' and processes the subtree, after which the
  * actual children are be processed. (in practice they are null though)
+ * Lightweight particles are drawn along with the objects.
  */
 static void geo_process_object_parent(struct GraphNodeObjectParent *node) {
     if (node->sharedChild != NULL) {
@@ -840,6 +1712,7 @@ static void geo_process_object_parent(struct GraphNodeObjectParent *node) {
     if (node->node.children != NULL) {
         geo_process_node_and_siblings(node->node.children);
     }
+    geo_process_particles();
 }
 
 /**
@@ -848,7 +1721,6 @@ static void geo_process_object_parent(struct GraphNodeObjectParent *node) {
 void geo_process_held_object(struct GraphNodeHeldObject *node) {
     Mat4 mat;
     Vec3f translation;
-    Mtx *mtx = alloc_display_list(sizeof(*mtx));
 
 #ifdef F3DEX_GBI_2
     gSPLookAt(gDisplayListHead++, &lookAt);
@@ -877,14 +1749,17 @@ void geo_process_held_object(struct GraphNodeHeldObject *node) {
                               (struct AllocOnlyPool *) gMatStack[gMatStackIndex + 1]);
         }
         gMatStackIndex++;
-        mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
-        gMatStackFixed[gMatStackIndex] = mtx;
+        geo_new_transform_version();
+        geo_convert_transform();
         gGeoTempState.type = gCurrAnimType;
         gGeoTempState.enabled = gCurrAnimEnabled;
         gGeoTempState.frame = gCurrAnimFrame;
         gGeoTempState.translationMultiplier = gCurrAnimTranslationMultiplier;
         gGeoTempState.attribute = gCurrAnimAttribute;
         gGeoTempState.data = gCurrAnimData;
+#ifdef ANIM_DECODE_CACHE
+        sTempAnimDecode = sCurAnimDecode;
+#endif
         gCurrAnimType = 0;
         gCurGraphNodeHeldObject = (void *) node;
         if (node->objNode->header.gfx.animInfo.curAnim != NULL) {
@@ -899,6 +1774,9 @@ void geo_process_held_object(struct GraphNodeHeldObject *node) {
         gCurrAnimTranslationMultiplier = gGeoTempState.translationMultiplier;
         gCurrAnimAttribute = gGeoTempState.attribute;
         gCurrAnimData = gGeoTempState.data;
+#ifdef ANIM_DECODE_CACHE
+        sCurAnimDecode = sTempAnimDecode;
+#endif
         gMatStackIndex--;
     }
 
@@ -925,6 +1803,9 @@ void geo_process_node_and_siblings(struct GraphNode *firstNode) {
     s16 iterateChildren = TRUE;
     struct GraphNode *curGraphNode = firstNode;
     struct GraphNode *parent = curGraphNode->parent;
+#ifdef GFX_POOL_PROFILER
+    struct GraphNode *parentProfileNode = gGfxPoolProfile.curNode;
+#endif
 
     // In the case of a switch node, exactly one of the children of the node is
     // processed instead of all children like usual
@@ -933,6 +1814,9 @@ void geo_process_node_and_siblings(struct GraphNode *firstNode) {
     }
 
     do {
+#ifdef GFX_POOL_PROFILER
+        gGfxPoolProfile.curNode = curGraphNode;
+#endif
         if (curGraphNode->flags & GRAPH_RENDER_ACTIVE) {
             if (curGraphNode->flags & GRAPH_RENDER_CHILDREN_FIRST) {
                 geo_try_process_children(curGraphNode);
@@ -996,6 +1880,11 @@ void geo_process_node_and_siblings(struct GraphNode *firstNode) {
                     case GRAPH_NODE_TYPE_HELD_OBJ:
                         geo_process_held_object((struct GraphNodeHeldObject *) curGraphNode);
                         break;
+#ifdef FLATTEN_STATIC_GEO
+                    case GRAPH_NODE_TYPE_FLATTENED:
+                        geo_process_flattened((struct GraphNodeFlattened *) curGraphNode);
+                        break;
+#endif
                     default:
                         geo_try_process_children((struct GraphNode *) curGraphNode);
                         break;
@@ -1007,6 +1896,9 @@ void geo_process_node_and_siblings(struct GraphNode *firstNode) {
             }
         }
     } while (iterateChildren && (curGraphNode = curGraphNode->next) != firstNode);
+#ifdef GFX_POOL_PROFILER
+    gGfxPoolProfile.curNode = parentProfileNode;
+#endif
 }
 
 /**
@@ -1042,10 +1934,24 @@ void geo_process_root(struct GraphNodeRoot *node, Vp *b, Vp *c, s32 clearColor)
         mtxf_identity(gMatStack[gMatStackIndex]);
         mtxf_to_mtx(initialMatrix, gMatStack[gMatStackIndex]);
         gMatStackFixed[gMatStackIndex] = initialMatrix;
+#ifdef MTX_CACHE
+        sMatStackVersion[gMatStackIndex] = 1;
+        sMatStackEntry[gMatStackIndex] = NULL;
+        sMtxCacheFrame++;
+#endif
         gSPViewport(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(viewport));
         gSPMatrix(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(gMatStackFixed[gMatStackIndex]),
                   G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_NOPUSH);
         gCurGraphNodeRoot = node;
+        gMasterListPipeSyncs = 0;
+        gMasterListUnsortedPipeSyncs = 0;
+        gMtxCacheBuilt = 0;
+        gMtxCacheReused = 0;
+        gShadowsBuilt = 0;
+        gShadowsReused = 0;
+#ifdef ANIM_DECODE_CACHE
+        clear_anim_decode_cache();
+#endif
         if (node->node.children != NULL) {
             geo_process_node_and_siblings(node->node.children);
         }
@@ -1053,6 +1959,18 @@ void geo_process_root(struct GraphNodeRoot *node, Vp *b, Vp *c, s32 clearColor)
         if (gShowDebugText) {
             print_text_fmt_int(180, 36, "MEM %d",
                                gDisplayListHeap->totalSpace - gDisplayListHeap->usedSpace);
+#ifdef MASTER_LIST_SORTING
+            print_text_fmt_int(180, 52, "SYNC %d", gMasterListPipeSyncs);
+            print_text_fmt_int(180, 68, "NOSORT %d", gMasterListUnsortedPipeSyncs);
+#endif
+#ifdef MTX_CACHE
+            print_text_fmt_int(180, 84, "MTX %d", gMtxCacheBuilt);
+            print_text_fmt_int(180, 100, "REUSE %d", gMtxCacheReused);
+#endif
+#ifdef SHADOW_CACHE
+            print_text_fmt_int(180, 116, "SHDW %d", gShadowsBuilt);
+            print_text_fmt_int(180, 132, "SHRE %d", gShadowsReused);
+#endif
         }
         main_pool_free(gDisplayListHeap);
     }
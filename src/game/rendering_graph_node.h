@@ -12,6 +12,10 @@ extern struct GraphNodeCamera *gCurGraphNodeCamera;
 extern struct GraphNodeObject *gCurGraphNodeObject;
 extern struct GraphNodeHeldObject *gCurGraphNodeHeldObject;
 extern u16 gAreaUpdateCounter;
+extern s32 gMasterListPipeSyncs;
+extern s32 gMasterListUnsortedPipeSyncs;
+extern s32 gMtxCacheBuilt;
+extern s32 gMtxCacheReused;
 
 // after processing an object, the type is reset to this
 #define ANIM_TYPE_NONE                  0
@@ -27,6 +31,10 @@ extern u16 gAreaUpdateCounter;
 // translation types the type is set to this
 #define ANIM_TYPE_ROTATION              5
 
+#ifdef MTX_CACHE
+void alloc_mtx_cache(void);
+void free_mtx_cache(void);
+#endif
 void geo_process_node_and_siblings(struct GraphNode *firstNode);
 void geo_process_root(struct GraphNodeRoot *node, Vp *b, Vp *c, s32 clearColor);
 
@@ -4,6 +4,8 @@
 
 #include "engine/math_util.h"
 #include "engine/surface_collision.h"
+#include "engine/surface_load.h"
+#include "game_init.h"
 #include "geo_misc.h"
 #include "level_table.h"
 #include "memory.h"
@@ -103,6 +105,73 @@ shadowRectangle rectangles[2] = {
 // See shadow.h for documentation.
 s8 gShadowAboveWaterOrLava;
 
+/**
+ * Number of shadows generated and reused this frame.
+ */
+s32 gShadowsBuilt;
+s32 gShadowsReused;
+
+#ifdef SHADOW_CACHE
+/**
+ * A shadow that is kept between frames. Shadow vertices are relative to the
+ * parent object, so they stay valid for as long as the object doesn't move and
+ * the floor, water and dynamic surfaces below it don't change. There are two
+ * buffers: when the shadow has to be rebuilt, the RSP may still be reading the
+ * one drawn in the previous frame.
+ */
+struct ShadowCache {
+    struct GraphNodeObject *owner;
+    /// What the shadow was generated from
+    f32 xPos, yPos, zPos;
+    f32 waterLevel;
+    u32 surfaceVersion;
+    s16 shadowScale;
+    u8 solidity;
+    s8 shadowType;
+    /// Whether the fields above describe the current shadow
+    s8 valid;
+    /// The result of the last generation
+    s8 aboveWaterOrLava;
+    Gfx *displayList;
+    /// gGlobalTimer of the frame each buffer was last drawn in
+    u32 frame[2];
+    /// The buffer that holds the current shadow
+    s8 cur;
+    Vtx verts[2][9];
+    Gfx gfx[2][5];
+};
+
+/**
+ * The cache, allocated from the main pool for each level by alloc_shadow_cache.
+ * Shadows aren't cached while it is NULL.
+ */
+static struct ShadowCache *sShadowCache = NULL;
+
+/**
+ * The cache buffer the shadow being created is written to, or NULL to allocate
+ * it from the display list pool.
+ */
+static struct ShadowCache *sShadowCacheTarget;
+
+/**
+ * Allocate an empty shadow cache from the main pool. Called on level load after
+ * the pool state is pushed, so that the cache is freed along with the level.
+ */
+void alloc_shadow_cache(void) {
+    sShadowCache = main_pool_alloc(SHADOW_CACHE_SIZE * sizeof(struct ShadowCache), MEMORY_POOL_LEFT);
+    if (sShadowCache != NULL) {
+        bzero(sShadowCache, SHADOW_CACHE_SIZE * sizeof(struct ShadowCache));
+    }
+}
+
+/**
+ * Stop using the shadow cache before the level's memory is freed.
+ */
+void free_shadow_cache(void) {
+    sShadowCache = NULL;
+}
+#endif
+
 /**
  * Return atan2(a, b) in degrees. Note that the argument order is swapped from
  * the standard atan2.
@@ -431,6 +500,30 @@ static void make_shadow_vertex(Vtx *vertices, s8 index, struct Shadow s,
     make_shadow_vertex_at_xyz(vertices, index, relX, relY, relZ, solidity, shadowVertexType);
 }
 
+/**
+ * Allocate the vertices of the shadow being created.
+ */
+static Vtx *alloc_shadow_vertices(s32 count) {
+#ifdef SHADOW_CACHE
+    if (sShadowCacheTarget != NULL) {
+        return sShadowCacheTarget->verts[sShadowCacheTarget->cur];
+    }
+#endif
+    return alloc_display_list(count * sizeof(Vtx));
+}
+
+/**
+ * Allocate the display list of the shadow being created.
+ */
+static Gfx *alloc_shadow_display_list(void) {
+#ifdef SHADOW_CACHE
+    if (sShadowCacheTarget != NULL) {
+        return sShadowCacheTarget->gfx[sShadowCacheTarget->cur];
+    }
+#endif
+    return alloc_display_list(5 * sizeof(Gfx));
+}
+
 /**
  * Add a shadow to the given display list.
  */
@@ -551,8 +644,8 @@ static Gfx *create_shadow_circle_9_verts(f32 xPos, f32 yPos, f32 zPos, s16 shado
         return NULL;
     }
 
-    verts = alloc_display_list(9 * sizeof(Vtx));
-    displayList = alloc_display_list(5 * sizeof(Gfx));
+    verts = alloc_shadow_vertices(9);
+    displayList = alloc_shadow_display_list();
 
     if (verts == NULL || displayList == NULL) {
         rmonpf(("For debug. Out of memory in ShadeDrawFunc !!\n"));
@@ -579,8 +672,8 @@ static Gfx *create_shadow_circle_4_verts(f32 xPos, f32 yPos, f32 zPos, s16 shado
         return NULL;
     }
 
-    verts = alloc_display_list(4 * sizeof(Vtx));
-    displayList = alloc_display_list(5 * sizeof(Gfx));
+    verts = alloc_shadow_vertices(4);
+    displayList = alloc_shadow_display_list();
 
     if (verts == NULL || displayList == NULL) {
         rmonpf(("For debug. Out of memory in ShadeDrawFunc !!\n"));
@@ -613,8 +706,8 @@ static Gfx *create_shadow_circle_assuming_flat_ground(f32 xPos, f32 yPos, f32 zP
         distBelowFloor = floorHeight - yPos;
     }
 
-    verts = alloc_display_list(4 * sizeof(Vtx));
-    displayList = alloc_display_list(5 * sizeof(Gfx));
+    verts = alloc_shadow_vertices(4);
+    displayList = alloc_shadow_display_list();
 
     if (verts == NULL || displayList == NULL) {
         rmonpf(("For debug. Out of memory in ShadeDrawFunc !!\n"));
@@ -657,8 +750,8 @@ static Gfx *create_shadow_player(f32 xPos, f32 yPos, f32 zPos, s16 shadowScale,
         return NULL;
     }
 
-    verts = alloc_display_list(9 * sizeof(Vtx));
-    displayList = alloc_display_list(5 * sizeof(Gfx));
+    verts = alloc_shadow_vertices(9);
+    displayList = alloc_shadow_display_list();
     if (verts == NULL || displayList == NULL) {
         rmonpf(("For debug. Out of memory in ShadeDrawFunc !!\n"));
         return NULL;
@@ -678,7 +771,45 @@ static Gfx *create_shadow_player(f32 xPos, f32 yPos, f32 zPos, s16 shadowScale,
 Gfx *create_shadow_below_xyz(f32 xPos, f32 yPos, f32 zPos, s16 shadowScale, u8 shadowSolidity,
                              s8 shadowType) {
     Gfx *displayList = NULL;
+#ifdef SHADOW_CACHE
+    struct ShadowCache *cache = NULL;
+    f32 waterLevel = 0.0f;
+    u32 surfaceVersion = 0;
+    s32 next;
+
+    sShadowCacheTarget = NULL;
+    // Player shadows also depend on the current animation, and rarely stand still
+    if (sShadowCache != NULL && gCurGraphNodeObject != NULL && shadowType != SHADOW_CIRCLE_MARIO
+        && shadowType != SHADOW_CIRCLE_LUIGI) {
+        cache = &sShadowCache[((((u32) gCurGraphNodeObject >> 2) * 0x9E3779B1) >> 16)
+                              & (SHADOW_CACHE_SIZE - 1)];
+        if (gEnvironmentRegions != NULL) {
+            waterLevel = find_water_level(xPos, zPos);
+        }
+        // The 9 vertex shadows look for floors up to half a diameter away
+        surfaceVersion = get_surface_version(xPos, zPos, shadowScale);
+
+        if (cache->valid && cache->owner == gCurGraphNodeObject && cache->xPos == xPos
+            && cache->yPos == yPos && cache->zPos == zPos && cache->shadowScale == shadowScale
+            && cache->solidity == shadowSolidity && cache->shadowType == shadowType
+            && cache->waterLevel == waterLevel && cache->surfaceVersion == surfaceVersion) {
+            if (cache->displayList != NULL) {
+                cache->frame[cache->cur] = gGlobalTimer;
+            }
+            gShadowAboveWaterOrLava = cache->aboveWaterOrLava;
+            gShadowsReused++;
+            return cache->displayList;
+        }
+
+        next = cache->cur ^ 1;
+        if (gGlobalTimer - cache->frame[next] >= 2) {
+            cache->cur = next;
+            sShadowCacheTarget = cache;
+        }
+    }
+#endif
 
+    gShadowsBuilt++;
     gShadowAboveWaterOrLava = FALSE;
     switch (shadowType) {
         case SHADOW_CIRCLE_9_VERTS:
@@ -700,5 +831,27 @@ Gfx *create_shadow_below_xyz(f32 xPos, f32 yPos, f32 zPos, s16 shadowScale, u8 s
                                                /* isLuigi */ TRUE);
             break;
     }
+
+#ifdef SHADOW_CACHE
+    if (cache != NULL) {
+        cache->owner = gCurGraphNodeObject;
+        cache->xPos = xPos;
+        cache->yPos = yPos;
+        cache->zPos = zPos;
+        cache->waterLevel = waterLevel;
+        cache->surfaceVersion = surfaceVersion;
+        cache->shadowScale = shadowScale;
+        cache->solidity = shadowSolidity;
+        cache->shadowType = shadowType;
+        cache->aboveWaterOrLava = gShadowAboveWaterOrLava;
+        cache->displayList = displayList;
+        // A shadow allocated from the display list pool is gone after this frame
+        cache->valid = sShadowCacheTarget != NULL || displayList == NULL;
+        if (sShadowCacheTarget != NULL && displayList != NULL) {
+            cache->frame[cache->cur] = gGlobalTimer;
+        }
+        sShadowCacheTarget = NULL;
+    }
+#endif
     return displayList;
 }
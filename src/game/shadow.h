@@ -29,10 +29,21 @@ enum ShadowType {
  */
 extern s8 gShadowAboveWaterOrLava;
 
+/**
+ * Number of shadows generated and reused this frame.
+ */
+extern s32 gShadowsBuilt;
+extern s32 gShadowsReused;
+
 /**
  * Given the (x, y, z) location of an object, create a shadow below that object
  * with the given initial solidity and "shadowType" (described above).
  */
 Gfx *create_shadow_below_xyz(f32 xPos, f32 yPos, f32 zPos, s16 shadowScale, u8 shadowSolidity, s8 shadowType);
 
+#ifdef SHADOW_CACHE
+void alloc_shadow_cache(void);
+void free_shadow_cache(void);
+#endif
+
 #endif // SHADOW_H
@@ -187,26 +187,103 @@ static s32 get_top_left_tile_idx(s8 player) {
  *                  into an x and y by modulus and division by SKYBOX_COLS. x and y are then scaled by
  *                  SKYBOX_TILE_WIDTH to get a point in world space.
  */
-Vtx *make_skybox_rect(s32 tileIndex, s8 colorIndex) {
-    Vtx *verts = alloc_display_list(4 * sizeof(*verts));
+static void fill_skybox_rect(Vtx *verts, s32 tileIndex, s8 colorIndex) {
     s16 x = tileIndex % SKYBOX_COLS * SKYBOX_TILE_WIDTH;
     s16 y = SKYBOX_HEIGHT - tileIndex / SKYBOX_COLS * SKYBOX_TILE_HEIGHT;
 
+    make_vertex(verts, 0, x, y, -1, 0, 0, sSkyboxColors[colorIndex][0], sSkyboxColors[colorIndex][1],
+                sSkyboxColors[colorIndex][2], 255);
+    make_vertex(verts, 1, x, y - SKYBOX_TILE_HEIGHT, -1, 0, 31 << 5, sSkyboxColors[colorIndex][0],
+                sSkyboxColors[colorIndex][1], sSkyboxColors[colorIndex][2], 255);
+    make_vertex(verts, 2, x + SKYBOX_TILE_WIDTH, y - SKYBOX_TILE_HEIGHT, -1, 31 << 5, 31 << 5,
+                sSkyboxColors[colorIndex][0], sSkyboxColors[colorIndex][1],
+                sSkyboxColors[colorIndex][2], 255);
+    make_vertex(verts, 3, x + SKYBOX_TILE_WIDTH, y, -1, 31 << 5, 0, sSkyboxColors[colorIndex][0],
+                sSkyboxColors[colorIndex][1], sSkyboxColors[colorIndex][2], 255);
+}
+
+/**
+ * Allocates and fills the vertices for the skybox tile from the display list pool.
+ */
+Vtx *make_skybox_rect(s32 tileIndex, s8 colorIndex) {
+    Vtx *verts = alloc_display_list(4 * sizeof(*verts));
+
     if (verts != NULL) {
-        make_vertex(verts, 0, x, y, -1, 0, 0, sSkyboxColors[colorIndex][0],
-                    sSkyboxColors[colorIndex][1], sSkyboxColors[colorIndex][2], 255);
-        make_vertex(verts, 1, x, y - SKYBOX_TILE_HEIGHT, -1, 0, 31 << 5, sSkyboxColors[colorIndex][0],
-                    sSkyboxColors[colorIndex][1], sSkyboxColors[colorIndex][2], 255);
-        make_vertex(verts, 2, x + SKYBOX_TILE_WIDTH, y - SKYBOX_TILE_HEIGHT, -1, 31 << 5, 31 << 5,
-                    sSkyboxColors[colorIndex][0], sSkyboxColors[colorIndex][1],
-                    sSkyboxColors[colorIndex][2], 255);
-        make_vertex(verts, 3, x + SKYBOX_TILE_WIDTH, y, -1, 31 << 5, 0, sSkyboxColors[colorIndex][0],
-                    sSkyboxColors[colorIndex][1], sSkyboxColors[colorIndex][2], 255);
+        fill_skybox_rect(verts, tileIndex, colorIndex);
     } else {
     }
     return verts;
 }
 
+#ifdef SKYBOX_STATIC_TILES
+/**
+ * The vertices of every tile in the tilemap, for one skybox color. They only depend on the tile
+ * index and color, so they are built the first time a color is drawn and reused from then on.
+ * The table is allocated from the main pool for each level by alloc_skybox_tile_verts, and is
+ * built for the first color drawn in the level. Other colors fall back to make_skybox_rect.
+ */
+static Vtx (*sSkyboxTileVerts)[4] = NULL;
+static s8 sSkyboxTileVertsColor = -1;
+
+/**
+ * Allocate the tile vertex table from the main pool. Called on level load after the pool state
+ * is pushed, so that the table is freed along with the level.
+ */
+void alloc_skybox_tile_verts(void) {
+    sSkyboxTileVerts = main_pool_alloc(SKYBOX_ROWS * SKYBOX_COLS * sizeof(*sSkyboxTileVerts),
+                                       MEMORY_POOL_LEFT);
+    sSkyboxTileVertsColor = -1;
+}
+
+/**
+ * Stop using the tile vertex table before the level's memory is freed.
+ */
+void free_skybox_tile_verts(void) {
+    sSkyboxTileVerts = NULL;
+    sSkyboxTileVertsColor = -1;
+}
+
+/**
+ * Returns the static vertices for the skybox tile, building the table for the color if needed.
+ */
+static Vtx *get_skybox_rect(s32 tileIndex, s8 colorIndex) {
+    if (sSkyboxTileVerts == NULL
+        || (sSkyboxTileVertsColor != -1 && sSkyboxTileVertsColor != colorIndex)) {
+        return make_skybox_rect(tileIndex, colorIndex);
+    }
+
+    if (sSkyboxTileVertsColor == -1) {
+        s32 i;
+
+        for (i = 0; i < SKYBOX_ROWS * SKYBOX_COLS; i++) {
+            fill_skybox_rect(sSkyboxTileVerts[i], i, colorIndex);
+        }
+        sSkyboxTileVertsColor = colorIndex;
+    }
+    return sSkyboxTileVerts[tileIndex];
+}
+#endif
+
+/**
+ * Get the horizontal extent of the skybox that is shown on screen, in the same units as scaledX.
+ * This is the left and right of the ortho matrix made by create_skybox_ortho_matrix.
+ */
+static void get_skybox_view_bounds(s8 player, f32 *left, f32 *right) {
+#ifdef WIDESCREEN
+    f32 halfWidth = (4.0f / 3.0f) / GFX_DIMENSIONS_ASPECT_RATIO * SCREEN_WIDTH / 2;
+    f32 center = (sSkyBoxInfo[player].scaledX + SCREEN_WIDTH / 2);
+
+    if (halfWidth < SCREEN_WIDTH / 2) {
+        // A wider screen than 4:3
+        *left = center - halfWidth;
+        *right = center + halfWidth;
+        return;
+    }
+#endif
+    *left = sSkyBoxInfo[player].scaledX;
+    *right = sSkyBoxInfo[player].scaledX + SCREEN_WIDTH;
+}
+
 /**
  * Draws a 3x3 grid of 32x32 sections of the original skybox image.
  * The row and column are converted into an index into the skybox's tile list, which is then drawn in
@@ -215,13 +292,36 @@ Vtx *make_skybox_rect(s32 tileIndex, s8 colorIndex) {
 void draw_skybox_tile_grid(Gfx **dlist, s8 background, s8 player, s8 colorIndex) {
     s32 row;
     s32 col;
+#ifdef SKYBOX_STATIC_TILES
+    f32 viewLeft;
+    f32 viewRight;
+    s32 viewTop = sSkyBoxInfo[player].scaledY;
+    s32 viewBottom = sSkyBoxInfo[player].scaledY - SCREEN_HEIGHT;
+
+    get_skybox_view_bounds(player, &viewLeft, &viewRight);
+#endif
 
     for (row = 0; row < 3; row++) {
         for (col = 0; col < 3; col++) {
             s32 tileIndex = sSkyBoxInfo[player].upperLeftTile + row * SKYBOX_COLS + col;
+#ifdef SKYBOX_STATIC_TILES
+            s32 x = tileIndex % SKYBOX_COLS * SKYBOX_TILE_WIDTH;
+            s32 y = SKYBOX_HEIGHT - tileIndex / SKYBOX_COLS * SKYBOX_TILE_HEIGHT;
+            const u8 *texture;
+            Vtx *vertices;
+
+            // Skip tiles that are entirely outside of the window, which saves their texture load
+            if (x >= viewRight || x + SKYBOX_TILE_WIDTH <= viewLeft || y <= viewBottom
+                || y - SKYBOX_TILE_HEIGHT >= viewTop) {
+                continue;
+            }
+            texture = (*(SkyboxTexture *) segmented_to_virtual(sSkyboxTextures[background]))[tileIndex];
+            vertices = get_skybox_rect(tileIndex, colorIndex);
+#else
             const u8 *const texture =
                 (*(SkyboxTexture *) segmented_to_virtual(sSkyboxTextures[background]))[tileIndex];
             Vtx *vertices = make_skybox_rect(tileIndex, colorIndex);
+#endif
 
             gLoadBlockTexture((*dlist)++, 32, 32, G_IM_FMT_RGBA, texture);
             gSPVertex((*dlist)++, VIRTUAL_TO_PHYSICAL(vertices), 4, 0);
@@ -231,21 +331,13 @@ void draw_skybox_tile_grid(Gfx **dlist, s8 background, s8 player, s8 colorIndex)
 }
 
 void *create_skybox_ortho_matrix(s8 player) {
-    f32 left = sSkyBoxInfo[player].scaledX;
-    f32 right = sSkyBoxInfo[player].scaledX + SCREEN_WIDTH;
+    f32 left;
+    f32 right;
     f32 bottom = sSkyBoxInfo[player].scaledY - SCREEN_HEIGHT;
     f32 top = sSkyBoxInfo[player].scaledY;
     Mtx *mtx = alloc_display_list(sizeof(*mtx));
 
-#ifdef WIDESCREEN
-    f32 half_width = (4.0f / 3.0f) / GFX_DIMENSIONS_ASPECT_RATIO * SCREEN_WIDTH / 2;
-    f32 center = (sSkyBoxInfo[player].scaledX + SCREEN_WIDTH / 2);
-    if (half_width < SCREEN_WIDTH / 2) {
-        // A wider screen than 4:3
-        left = center - half_width;
-        right = center + half_width;
-    }
-#endif
+    get_skybox_view_bounds(player, &left, &right);
 
     if (mtx != NULL) {
         guOrtho(mtx, left, right, bottom, top, 0.0f, 3.0f, 1.0f);
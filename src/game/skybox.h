@@ -7,5 +7,9 @@
 Gfx *create_skybox_facing_camera(s8 player, s8 background, f32 fov,
                                  f32 posX, f32 posY, f32 posZ,
                                  f32 focX, f32 focY, f32 focZ);
+#ifdef SKYBOX_STATIC_TILES
+void alloc_skybox_tile_verts(void);
+void free_skybox_tile_verts(void);
+#endif
 
 #endif // SKYBOX_H
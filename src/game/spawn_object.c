@@ -1,4 +1,5 @@
 #include <PR/ultratypes.h>
+#include <stddef.h>
 
 #include "audio/external.h"
 #include "engine/geo_layout.h"
@@ -13,6 +14,47 @@
 #include "spawn_object.h"
 #include "types.h"
 
+#if !IS_64_BIT
+/**
+ * struct Object is split into a hot block, read for every object every frame
+ * by list processing, collision and rendering, and a cold block after the
+ * object fields. Check that the layout documented in types.h and
+ * object_fields.h holds, so that reordering the struct can't silently move a
+ * hot field out of the block or shift the object field offsets.
+ */
+STATIC_ASSERT(offsetof(struct Object, parentObj) == 0x068, "hot block must follow the graph node");
+STATIC_ASSERT(offsetof(struct Object, collisionData) < offsetof(struct Object, rawData),
+              "collision fields must be in the hot block");
+STATIC_ASSERT(offsetof(struct Object, hitboxDownOffset) < offsetof(struct Object, rawData),
+              "hitbox fields must be in the hot block");
+STATIC_ASSERT(offsetof(struct Object, bhvDelayTimer) < offsetof(struct Object, rawData),
+              "behavior script state must be in the hot block");
+STATIC_ASSERT(offsetof(struct Object, rawData) == 0x0B4, "object field offsets in object_fields.h");
+STATIC_ASSERT(offsetof(struct Object, prevObj) == 0x1F4, "cold block must follow the object fields");
+STATIC_ASSERT(sizeof(struct Object) == 0x260, "struct Object size");
+#endif
+
+/**
+ * A behavior whose per-behavior spawn data was already looked up during the
+ * current spawn batch.
+ */
+struct SpawnBatchBehavior {
+    const BehaviorScript *behavior;
+    s16 sleepRule;
+};
+
+// Must be a power of two.
+#define SPAWN_BATCH_BEHAVIOR_CACHE_SIZE 32
+
+/**
+ * Batch spawning state, see begin_object_spawn_batch.
+ */
+static s8 sSpawnBatchActive = FALSE;
+static s8 sSpawnBatchOriginFloorFound;
+static f32 sSpawnBatchOriginFloorHeight;
+static struct GraphNode *sSpawnBatchGraphNodes;
+static struct SpawnBatchBehavior sSpawnBatchBehaviors[SPAWN_BATCH_BEHAVIOR_CACHE_SIZE];
+
 /**
  * An unused linked list struct that seems to have been replaced by ObjectNode.
  */
@@ -70,6 +112,106 @@ struct LinkedList *unused_try_allocate(struct LinkedList *destList, struct Linke
     return node;
 }
 
+/**
+ * Append an object's graph node to the list of nodes that will be linked
+ * under gObjParentGraphNode when the spawn batch is flushed. The pending list
+ * is circular, like a list of graph node children.
+ */
+static void defer_object_graph_node(struct GraphNode *node) {
+    struct GraphNode *first = sSpawnBatchGraphNodes;
+
+    node->parent = &gObjParentGraphNode;
+
+    if (first == NULL) {
+        sSpawnBatchGraphNodes = node;
+        node->prev = node;
+        node->next = node;
+    } else {
+        node->prev = first->prev;
+        node->next = first;
+        first->prev->next = node;
+        first->prev = node;
+    }
+}
+
+/**
+ * Splice the graph nodes of the objects spawned in the current batch onto the
+ * end of gObjParentGraphNode's children in one step, in the order they were
+ * spawned.
+ */
+static void flush_object_spawn_batch(void) {
+    struct GraphNode *first = sSpawnBatchGraphNodes;
+    struct GraphNode *last;
+    struct GraphNode *parentFirst;
+
+    if (first == NULL) {
+        return;
+    }
+
+    parentFirst = gObjParentGraphNode.children;
+    if (parentFirst == NULL) {
+        gObjParentGraphNode.children = first;
+    } else {
+        last = first->prev;
+        first->prev = parentFirst->prev;
+        last->next = parentFirst;
+        parentFirst->prev->next = first;
+        parentFirst->prev = last;
+    }
+
+    sSpawnBatchGraphNodes = NULL;
+}
+
+/**
+ * Start a batch of object spawns, used when placing the objects of an area.
+ * Until end_object_spawn_batch is called:
+ * - graph nodes of new objects are linked into the scene graph in a single
+ *   splice at the end of the batch, instead of one by one
+ * - per-behavior data looked up by create_object is cached
+ * - the floor snap that create_object does at the origin is computed once,
+ *   since no surfaces change during a batch
+ * The scene graph must not be walked while a batch is open.
+ */
+void begin_object_spawn_batch(void) {
+    s32 i;
+
+    for (i = 0; i < SPAWN_BATCH_BEHAVIOR_CACHE_SIZE; i++) {
+        sSpawnBatchBehaviors[i].behavior = NULL;
+    }
+
+    sSpawnBatchGraphNodes = NULL;
+    sSpawnBatchOriginFloorFound = FALSE;
+    sSpawnBatchActive = TRUE;
+}
+
+/**
+ * Finish a batch of object spawns, linking the new objects' graph nodes.
+ */
+void end_object_spawn_batch(void) {
+    flush_object_spawn_batch();
+    sSpawnBatchActive = FALSE;
+}
+
+/**
+ * Return the sleep rule for a behavior, using the batch cache if a spawn batch
+ * is open.
+ */
+static s16 get_spawn_sleep_rule(const BehaviorScript *behavior) {
+    struct SpawnBatchBehavior *cached;
+
+    if (!sSpawnBatchActive) {
+        return get_object_sleep_rule(behavior);
+    }
+
+    cached = &sSpawnBatchBehaviors[((uintptr_t) behavior >> 2) & (SPAWN_BATCH_BEHAVIOR_CACHE_SIZE - 1)];
+    if (cached->behavior != behavior) {
+        cached->behavior = behavior;
+        cached->sleepRule = get_object_sleep_rule(behavior);
+    }
+
+    return cached->sleepRule;
+}
+
 /**
  * Attempt to allocate an object from freeList (singly linked) and append it
  * to the end of destList (doubly linked). Return the object, or NULL if
@@ -92,7 +234,11 @@ struct Object *try_allocate_object(struct ObjectNode *destList, struct ObjectNod
     }
 
     geo_remove_child(&nextObj->gfx.node);
-    geo_add_child(&gObjParentGraphNode, &nextObj->gfx.node);
+    if (sSpawnBatchActive) {
+        defer_object_graph_node(&nextObj->gfx.node);
+    } else {
+        geo_add_child(&gObjParentGraphNode, &nextObj->gfx.node);
+    }
 
     return (struct Object *) nextObj;
 }
@@ -126,24 +272,37 @@ static void deallocate_object(struct ObjectNode *freeList, struct ObjectNode *ob
 }
 
 /**
- * Add every object in the pool to the free object list.
+ * Singly link count objects starting at pool, ending the chain with next.
+ * Return the first node of the chain.
  */
-void init_free_object_list(void) {
+static struct ObjectNode *link_free_objects(struct Object *pool, s32 count, struct ObjectNode *next) {
     s32 i;
-    s32 poolLength = OBJECT_POOL_CAPACITY;
-
-    // Add the first object in the pool to the free list
-    struct Object *obj = &gObjectPool[0];
-    gFreeObjectList.next = (struct ObjectNode *) obj;
+    struct Object *obj = pool;
 
     // Link each object in the pool to the following object
-    for (i = 0; i < poolLength - 1; i++) {
+    for (i = 0; i < count - 1; i++) {
         obj->header.next = &(obj + 1)->header;
         obj++;
     }
 
-    // End the list
-    obj->header.next = NULL;
+    // End the chain
+    obj->header.next = next;
+
+    return &pool->header;
+}
+
+/**
+ * Add every object in the pool, followed by every object in the second slab
+ * if the level reserved one, to the free object list.
+ */
+void init_free_object_list(void) {
+    struct ObjectNode *slab2 = NULL;
+
+    if (gObjectSlab2 != NULL && gObjectSlab2Capacity > 0) {
+        slab2 = link_free_objects(gObjectSlab2, gObjectSlab2Capacity, NULL);
+    }
+
+    gFreeObjectList.next = link_free_objects(gObjectPool, OBJECT_POOL_CAPACITY, slab2);
 }
 
 /**
@@ -187,6 +346,7 @@ UNUSED static void unused_delete_leaf_nodes(struct Object *obj) {
 void unload_object(struct Object *obj) {
     obj->activeFlags = ACTIVE_FLAG_DEACTIVATED;
     obj->prevObj = NULL;
+    obj_update_time_stop_exemption(obj);
 
     obj->header.gfx.throwMatrix = NULL;
     stop_sounds_from_source(obj->header.gfx.cameraToObject);
@@ -215,6 +375,10 @@ struct Object *allocate_object(struct ObjectNode *objList) {
         // Look for an unimportant object to kick out.
         struct Object *unimportantObj = find_unimportant_object();
 
+        // Unloading relinks the object's graph node, so the nodes of a spawn
+        // batch must be in the scene graph first.
+        flush_object_spawn_batch();
+
         // If no unimportant object exists, then the object pool is exhausted.
         if (unimportantObj == NULL) {
             // We've met with a terrible fate.
@@ -252,8 +416,10 @@ struct Object *allocate_object(struct ObjectNode *objList) {
         obj->rawData.asS32[i] = 0;
 #endif
 
-    obj->unused1 = 0;
+    obj->sleepRule = 0;
+    obj->sleepFrames = 0;
     obj->bhvStackIndex = 0;
+    obj->bhvDecodedScript = NULL;
     obj->bhvDelayTimer = 0;
 
     obj->hitboxRadius = 50.0f;
@@ -261,7 +427,6 @@ struct Object *allocate_object(struct ObjectNode *objList) {
     obj->hurtboxRadius = 0.0f;
     obj->hurtboxHeight = 0.0f;
     obj->hitboxDownOffset = 0.0f;
-    obj->unused2 = 0;
 
     obj->platform = NULL;
     obj->collisionData = NULL;
@@ -299,7 +464,17 @@ struct Object *allocate_object(struct ObjectNode *objList) {
 static void snap_object_to_floor(struct Object *obj) {
     struct Surface *surface;
 
-    obj->oFloorHeight = find_floor(obj->oPosX, obj->oPosY, obj->oPosZ, &surface);
+    // Objects are always snapped at the origin (see create_object), so a batch
+    // only needs to look up the floor there once.
+    if (sSpawnBatchActive && obj->oPosX == 0.0f && obj->oPosY == 0.0f && obj->oPosZ == 0.0f) {
+        if (!sSpawnBatchOriginFloorFound) {
+            sSpawnBatchOriginFloorHeight = find_floor(0.0f, 0.0f, 0.0f, &surface);
+            sSpawnBatchOriginFloorFound = TRUE;
+        }
+        obj->oFloorHeight = sSpawnBatchOriginFloorHeight;
+    } else {
+        obj->oFloorHeight = find_floor(obj->oPosX, obj->oPosY, obj->oPosZ, &surface);
+    }
 
     if (obj->oFloorHeight + 2.0f > obj->oPosY && obj->oPosY > obj->oFloorHeight - 10.0f) {
         obj->oPosY = obj->oFloorHeight;
@@ -329,11 +504,18 @@ struct Object *create_object(const BehaviorScript *bhvScript) {
 
     obj->curBhvCommand = bhvScript;
     obj->behavior = behavior;
+    obj->sleepRule = get_spawn_sleep_rule(behavior);
 
     if (objListIndex == OBJ_LIST_UNIMPORTANT) {
         obj->activeFlags |= ACTIVE_FLAG_UNIMPORTANT;
     }
 
+    // Stopped frames only visit objects that can be unfrozen, so the new
+    // object's animation must be frozen by a full walk
+    if (gTimeStopState & TIME_STOP_ACTIVE) {
+        request_time_stop_full_walk();
+    }
+
     //! They intended to snap certain objects to the floor when they spawn.
     //  However, at this point the object's position is the origin. So this will
     //  place the object at the floor beneath the origin. Typically this
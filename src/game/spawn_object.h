@@ -7,6 +7,8 @@ void init_free_object_list(void);
 void clear_object_lists(struct ObjectNode *objLists);
 void unload_object(struct Object *obj);
 struct Object *create_object(const BehaviorScript *bhvScript);
+void begin_object_spawn_batch(void);
+void end_object_spawn_batch(void);
 void mark_obj_for_deletion(struct Object *obj);
 
 #endif // SPAWN_OBJECT_H
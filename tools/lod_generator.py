@@ -0,0 +1,611 @@
+#!/usr/bin/env python3
+#
+# Generates distance LOD versions of actor models.
+#
+# For every model listed in the LOD config (actors/lod.json), the display
+# lists referenced by the model's geo layout are decimated with quadric error
+# edge collapses, and a copy of the geo layout is written in which every
+# decimated display list is replaced with a set of render range (LOD) nodes.
+#
+#   lod_generator.py CONFIG BUILD_DIR             generate all models
+#   lod_generator.py --inputs CONFIG              list the source files
+#   lod_generator.py --outputs CONFIG BUILD_DIR   list the generated files
+#
+# Config format:
+#
+#   [
+#       {
+#           "model": "actors/penguin/ping.sou",
+#           "geo": "actors/penguin/ping.hms",
+#           "lods": [
+#               { "distance": 1500, "ratio": 0.6 },
+#               { "distance": 3000, "ratio": 0.3 }
+#           ]
+#       }
+#   ]
+#
+# The full model is drawn closer than the first distance, and each LOD from
+# its distance up to the next one. "ratio" is the fraction of triangles kept.
+#
+# Only display lists made of vertex loads, triangles and state commands are
+# decimated. Display lists that call other display lists, or that change
+# lighting or geometry mode between loading a vertex and using it, are left
+# alone, as are display lists that would not lose any triangles.
+#
+import heapq
+import json
+import os
+import re
+import sys
+
+VTX_BUFFER_SIZE = 16
+LOD_NEAR_DISTANCE = -2048
+LOD_FAR_DISTANCE = 32767
+
+# Commands that change how vertices are transformed or lit when they are loaded
+VTX_STATE_COMMANDS = {
+    "gsSPLight", "gsSPSetLights0", "gsSPSetLights1", "gsSPSetLights2", "gsSPSetLights3",
+    "gsSPSetLights4", "gsSPSetLights5", "gsSPSetLights6", "gsSPSetLights7", "gsSPNumLights",
+    "gsSPLightColor", "gsSPLookAt", "gsSPLookAtX", "gsSPLookAtY", "gsSPSetGeometryMode",
+    "gsSPClearGeometryMode", "gsSPGeometryMode", "gsSPLoadGeometryMode", "gsSPTexture",
+    "gsSPMatrix", "gsSPPopMatrix", "gsSPFogPosition", "gsSPFogFactor", "gsSPPerspNormalize",
+}
+
+# Commands that can't be followed statically
+UNSUPPORTED_COMMANDS = {
+    "gsSPDisplayList", "gsSPBranchList", "gsSPBranchLessZ", "gsSPModifyVertex",
+    "gsSPCullDisplayList", "gsSPSegment",
+}
+
+ARRAY_RE = re.compile(r"^[ \t]*((?:static\s+)?(?:const\s+)?)(Vtx|Gfx)\s+(\w+)\s*\[\s*\]\s*=\s*\{", re.M)
+NUMBER_RE = re.compile(r"-?(?:0x[0-9a-fA-F]+|\d+)")
+COMMAND_RE = re.compile(r"^\s*(\w+)\s*\((.*)\)\s*$", re.S)
+VTX_PTR_RE = re.compile(r"^\(*\s*&?\s*(\w+)\s*(?:\[\s*(\w+)\s*\]|\+\s*(\w+))?\s*\)*$")
+
+
+def fail(msg):
+    print("lod_generator: " + msg, file=sys.stderr)
+    sys.exit(1)
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", lambda m: " " * len(m.group(0)), text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def split_top_level(text, sep=","):
+    parts = []
+    depth = 0
+    start = 0
+    for i, c in enumerate(text):
+        if c in "({[":
+            depth += 1
+        elif c in ")}]":
+            depth -= 1
+        elif c == sep and depth == 0:
+            parts.append(text[start:i])
+            start = i + 1
+    parts.append(text[start:])
+    return [p.strip() for p in parts if p.strip()]
+
+
+def find_arrays(text):
+    """Return {name: (qualifiers, type, body)} for every Vtx and Gfx array."""
+    arrays = {}
+    for m in ARRAY_RE.finditer(text):
+        depth = 1
+        i = m.end()
+        while depth > 0 and i < len(text):
+            if text[i] == "{":
+                depth += 1
+            elif text[i] == "}":
+                depth -= 1
+            i += 1
+        arrays[m.group(3)] = (m.group(1), m.group(2), text[m.end():i - 1])
+    return arrays
+
+
+def parse_vtx(body):
+    vertices = []
+    for entry in split_top_level(body):
+        nums = [int(n, 0) for n in NUMBER_RE.findall(entry)]
+        if len(nums) != 10:
+            return None
+        vertices.append(nums)
+    return vertices
+
+
+def parse_int(s):
+    try:
+        return int(s, 0)
+    except ValueError:
+        return None
+
+
+class Triangle:
+    def __init__(self, corners, flag):
+        self.corners = corners  # (vtx array name, index) per corner
+        self.flag = flag
+
+
+def parse_display_list(body, vtx_arrays):
+    """
+    Turn a display list into a list of items: ("cmd", text) for commands that
+    are kept as is, and ("tri", Triangle) for triangles. Vertex loads are
+    resolved and dropped. Returns None if the display list can't be decimated.
+    """
+    if "#" in body:
+        return None
+    items = []
+    slots = [None] * 32
+    epoch = 0
+    ended = False
+    for command in split_top_level(body):
+        m = COMMAND_RE.match(command)
+        if m is None:
+            return None
+        name = m.group(1)
+        args = split_top_level(m.group(2))
+        if ended or name in UNSUPPORTED_COMMANDS:
+            return None
+        if name == "gsSPEndDisplayList":
+            items.append(("cmd", command))
+            ended = True
+        elif name == "gsSPVertex":
+            ptr = VTX_PTR_RE.match(args[0])
+            count = parse_int(args[1])
+            v0 = parse_int(args[2])
+            if ptr is None or ptr.group(1) not in vtx_arrays or count is None or v0 is None:
+                return None
+            offset = parse_int(ptr.group(2) or ptr.group(3) or "0")
+            if offset is None or v0 + count > len(slots) or offset + count > len(vtx_arrays[ptr.group(1)]):
+                return None
+            for i in range(count):
+                slots[v0 + i] = ((ptr.group(1), offset + i), epoch)
+        elif name in ("gsSP1Triangle", "gsSP2Triangles"):
+            values = [parse_int(a) for a in args]
+            if None in values:
+                return None
+            for t in range(0, len(values), 4):
+                corners = []
+                for v in values[t:t + 3]:
+                    if v >= len(slots) or slots[v] is None or slots[v][1] != epoch:
+                        return None
+                    corners.append(slots[v][0])
+                items.append(("tri", Triangle(tuple(corners), values[t + 3])))
+        else:
+            if name in VTX_STATE_COMMANDS or not name.startswith("gsDP"):
+                epoch += 1
+            items.append(("cmd", command))
+    if not ended:
+        return None
+    return items
+
+
+#
+# Quadric error metric decimation. Vertices that share a position are merged
+# into one cluster, so collapsing an edge moves every vertex of the cluster and
+# flat shaded seams don't open up.
+#
+
+def plane_quadric(p0, p1, p2, weight=1.0):
+    ux, uy, uz = (p1[i] - p0[i] for i in range(3))
+    vx, vy, vz = (p2[i] - p0[i] for i in range(3))
+    nx, ny, nz = uy * vz - uz * vy, uz * vx - ux * vz, ux * vy - uy * vx
+    length = (nx * nx + ny * ny + nz * nz) ** 0.5
+    if length == 0.0:
+        return [0.0] * 10
+    area = length * 0.5
+    nx, ny, nz = nx / length, ny / length, nz / length
+    d = -(nx * p0[0] + ny * p0[1] + nz * p0[2])
+    w = area * weight
+    return [w * nx * nx, w * nx * ny, w * nx * nz, w * nx * d,
+            w * ny * ny, w * ny * nz, w * ny * d,
+            w * nz * nz, w * nz * d,
+            w * d * d]
+
+
+def add_quadric(a, b):
+    return [a[i] + b[i] for i in range(10)]
+
+
+def quadric_error(q, p):
+    x, y, z = p
+    return (q[0] * x * x + 2 * q[1] * x * y + 2 * q[2] * x * z + 2 * q[3] * x
+            + q[4] * y * y + 2 * q[5] * y * z + 2 * q[6] * y
+            + q[7] * z * z + 2 * q[8] * z + q[9])
+
+
+def face_normal(p0, p1, p2):
+    ux, uy, uz = (p1[i] - p0[i] for i in range(3))
+    vx, vy, vz = (p2[i] - p0[i] for i in range(3))
+    return (uy * vz - uz * vy, uz * vx - ux * vz, ux * vy - uy * vx)
+
+
+def decimate(positions, faces, target):
+    """
+    positions: list of cluster positions. faces: list of cluster triples.
+    Collapses edges until at most 'target' faces are left. Returns the cluster
+    each cluster was merged into and the set of faces that are left.
+    """
+    parent = list(range(len(positions)))
+    pos = [tuple(float(c) for c in p) for p in positions]
+    alive = set(range(len(faces)))
+    cluster_faces = [set() for _ in positions]
+    quadrics = [[0.0] * 10 for _ in positions]
+    edge_use = {}
+
+    for f, (a, b, c) in enumerate(faces):
+        q = plane_quadric(pos[a], pos[b], pos[c])
+        for v in (a, b, c):
+            cluster_faces[v].add(f)
+            quadrics[v] = add_quadric(quadrics[v], q)
+        for e in ((a, b), (b, c), (c, a)):
+            key = (min(e), max(e))
+            edge_use.setdefault(key, []).append(f)
+
+    # Keep open borders in place with planes perpendicular to the border faces
+    for (a, b), users in edge_use.items():
+        if len(users) == 1:
+            fa, fb, fc = faces[users[0]]
+            n = face_normal(pos[fa], pos[fb], pos[fc])
+            edge = tuple(pos[b][i] - pos[a][i] for i in range(3))
+            side = (edge[1] * n[2] - edge[2] * n[1], edge[2] * n[0] - edge[0] * n[2],
+                    edge[0] * n[1] - edge[1] * n[0])
+            p2 = tuple(pos[a][i] + side[i] for i in range(3))
+            q = plane_quadric(pos[a], pos[b], p2, 10.0)
+            quadrics[a] = add_quadric(quadrics[a], q)
+            quadrics[b] = add_quadric(quadrics[b], q)
+
+    def find(v):
+        while parent[v] != v:
+            parent[v] = parent[parent[v]]
+            v = parent[v]
+        return v
+
+    def corners(f):
+        return tuple(find(v) for v in faces[f])
+
+    def collapse_cost(a, b):
+        q = add_quadric(quadrics[a], quadrics[b])
+        ea = quadric_error(q, pos[a])
+        eb = quadric_error(q, pos[b])
+        return (eb, a, b) if eb <= ea else (ea, b, a)
+
+    def flips(src, dst):
+        for f in cluster_faces[src]:
+            if f not in alive:
+                continue
+            c = corners(f)
+            if dst in c:
+                continue
+            before = face_normal(*(pos[v] for v in c))
+            after = face_normal(*(pos[dst] if v == src else pos[v] for v in c))
+            if sum(before[i] * after[i] for i in range(3)) <= 0.0:
+                return True
+        return False
+
+    version = [0] * len(positions)
+    heap = []
+    for a, b in edge_use:
+        cost, src, dst = collapse_cost(a, b)
+        heapq.heappush(heap, (cost, src, dst, version[src], version[dst]))
+
+    while len(alive) > target and heap:
+        cost, src, dst, vs, vd = heapq.heappop(heap)
+        if find(src) != src or find(dst) != dst or vs != version[src] or vd != version[dst]:
+            continue
+        if flips(src, dst):
+            continue
+
+        parent[src] = dst
+        quadrics[dst] = add_quadric(quadrics[dst], quadrics[src])
+        for f in cluster_faces[src]:
+            if f in alive:
+                c = corners(f)
+                if len(set(c)) < 3:
+                    alive.discard(f)
+                else:
+                    cluster_faces[dst].add(f)
+        version[dst] += 1
+
+        neighbours = set()
+        for f in cluster_faces[dst]:
+            if f in alive:
+                neighbours.update(corners(f))
+        neighbours.discard(dst)
+        for n in neighbours:
+            cost, s, d = collapse_cost(n, dst)
+            heapq.heappush(heap, (cost, s, d, version[s], version[d]))
+
+    return [find(v) for v in range(len(positions))], alive
+
+
+class DisplayList:
+    def __init__(self, name, qualifiers, items, vtx_arrays):
+        self.name = name
+        self.qualifiers = qualifiers.replace("static", "").strip()
+        self.items = items
+        self.vtx_arrays = vtx_arrays
+        self.triangles = [item[1] for item in items if item[0] == "tri"]
+
+    def build_lod(self, ratio, vtx_name):
+        """
+        Returns (vertex entries, commands, triangle count) of the decimated
+        display list, or None if no triangles could be removed.
+        """
+        clusters = {}
+        cluster_of = {}
+        positions = []
+        for tri in self.triangles:
+            for corner in tri.corners:
+                if corner in cluster_of:
+                    continue
+                p = tuple(self.vtx_arrays[corner[0]][corner[1]][0:3])
+                if p not in clusters:
+                    clusters[p] = len(positions)
+                    positions.append(p)
+                cluster_of[corner] = clusters[p]
+
+        faces = [tuple(cluster_of[c] for c in tri.corners) for tri in self.triangles]
+        target = max(1, int(len(faces) * ratio + 0.5))
+        merged, alive = decimate(positions, faces, target)
+        if len(alive) >= len(faces):
+            return None
+
+        alive_tris = set(self.triangles[f] for f in alive)
+        vertices = []
+        commands = []
+        batch = []
+        pending = []
+
+        # Reload the surviving triangles' vertices in batches that fit the vertex buffer
+        def flush():
+            if not batch:
+                return
+            start = len(vertices)
+            slot_of = {}
+            for corner in batch:
+                slot_of[corner] = len(vertices) - start
+                vtx = list(self.vtx_arrays[corner[0]][corner[1]])
+                vtx[0:3] = positions[merged[cluster_of[corner]]]
+                vertices.append(vtx)
+            commands.append("gsSPVertex(&%s[%d], %d, 0)" % (vtx_name, start, len(batch)))
+            for tri in pending:
+                commands.append("gsSP1Triangle(%d, %d, %d, 0x%x)"
+                                % (slot_of[tri.corners[0]], slot_of[tri.corners[1]],
+                                   slot_of[tri.corners[2]], tri.flag))
+            del batch[:]
+            del pending[:]
+
+        for kind, value in self.items:
+            if kind == "cmd":
+                flush()
+                commands.append(value)
+                continue
+            if value not in alive_tris:
+                continue
+            new = [c for c in dict.fromkeys(value.corners) if c not in batch]
+            if len(batch) + len(new) > VTX_BUFFER_SIZE:
+                flush()
+                new = list(dict.fromkeys(value.corners))
+            batch.extend(new)
+            pending.append(value)
+        flush()
+        return vertices, commands, len(alive)
+
+
+def format_vtx(v):
+    x, y, z, flag, s, t, r, g, b, a = v
+    return "    {{{%6d, %6d, %6d}, %d, {%6d, %6d}, {0x%02x, 0x%02x, 0x%02x, 0x%02x}}}," % (
+        x, y, z, flag, s, t, r & 0xFF, g & 0xFF, b & 0xFF, a & 0xFF)
+
+
+def lod_name(name, level):
+    return "%s_lod%d" % (name, level + 1)
+
+
+def output_paths(entry, build_dir):
+    model_base = os.path.splitext(entry["model"])[0]
+    if model_base.endswith(".inc"):
+        model_base = model_base[:-4]
+    geo_base, geo_ext = os.path.splitext(entry["geo"])
+    if geo_base.endswith(".inc"):
+        geo_base = geo_base[:-4]
+        geo_ext = ".inc.c"
+    return (os.path.join(build_dir, model_base + ".lod.inc.c"),
+            os.path.join(build_dir, geo_base + ".lod" + geo_ext))
+
+
+GEO_NODE_RE = re.compile(r"^(\s*)(hmsJoint|GEO_ANIMATED_PART|hmsGfx|GEO_DISPLAY_LIST)\s*\(")
+
+
+def parse_geo_node(line):
+    """Split a geo command line into (indent, macro, arguments, trailing text)."""
+    m = GEO_NODE_RE.match(line)
+    if m is None:
+        return None
+    depth = 1
+    i = m.end()
+    while depth > 0 and i < len(line):
+        if line[i] == "(":
+            depth += 1
+        elif line[i] == ")":
+            depth -= 1
+        i += 1
+    if depth != 0:
+        return None
+    rest = line[i:].lstrip()
+    if rest.startswith(","):
+        rest = rest[1:].lstrip()
+    return m.group(1), m.group(2), split_top_level(line[m.end():i - 1]), rest
+
+
+def rewrite_geo(lines, lods, distances):
+    out = []
+    for line in lines:
+        node = parse_geo_node(line)
+        if node is None:
+            out.append(line)
+            continue
+        indent, macro, args, rest = node
+        hms = macro.startswith("hms")
+        if macro == "hmsJoint":
+            layer, dl = args[0], args[1]
+        elif macro == "GEO_ANIMATED_PART":
+            layer, dl = args[0], args[4]
+        else:
+            layer, dl = args[0], args[1]
+        if dl not in lods:
+            out.append(line)
+            continue
+
+        # The display list moves into render range children of this node.
+        # Children of a node can be added with more than one open/close pair,
+        # so the node's own children (if any) still follow after this block.
+        rest = " " + rest if rest else ""
+        if macro == "hmsJoint":
+            args[1] = "NULL"
+            out.append("%s%s(%s)%s" % (indent, macro, ",".join(args), rest))
+        elif macro == "GEO_ANIMATED_PART":
+            args[4] = "NULL"
+            out.append("%s%s(%s),%s" % (indent, macro, ", ".join(args), rest))
+        elif hms:
+            out.append("%shmsGroup()%s" % (indent, rest))
+        else:
+            out.append("%sGEO_NODE_START(),%s" % (indent, rest))
+
+        names = [dl] + [lod_name(dl, i) if lods[dl][i] else None for i in range(len(distances))]
+        ranges = [LOD_NEAR_DISTANCE] + distances + [LOD_FAR_DISTANCE]
+        step = "    "
+        out.append(indent + ("hmsBegin()" if hms else "GEO_OPEN_NODE(),"))
+        i = 0
+        while i < len(names):
+            # A level that couldn't be simplified further reuses the previous one
+            j = i + 1
+            while j < len(names) and names[j] is None:
+                j += 1
+            if hms:
+                out.append("%s%shmsLOD(%d, %d)" % (indent, step, ranges[i], ranges[j]))
+                out.append("%s%shmsBegin()" % (indent, step))
+                out.append("%s%s%shmsGfx(%s, %s)" % (indent, step, step, layer, names[i]))
+                out.append("%s%shmsEnd()" % (indent, step))
+            else:
+                out.append("%s%sGEO_RENDER_RANGE(%d, %d)," % (indent, step, ranges[i], ranges[j]))
+                out.append("%s%sGEO_OPEN_NODE()," % (indent, step))
+                out.append("%s%s%sGEO_DISPLAY_LIST(%s, %s)," % (indent, step, step, layer, names[i]))
+                out.append("%s%sGEO_CLOSE_NODE()," % (indent, step))
+            i = j
+        out.append(indent + ("hmsEnd()" if hms else "GEO_CLOSE_NODE(),"))
+    return out
+
+
+def generate(entry, build_dir):
+    model_path, geo_path = entry["model"], entry["geo"]
+    levels = entry["lods"]
+    distances = [int(level["distance"]) for level in levels]
+    ratios = [float(level["ratio"]) for level in levels]
+    if distances != sorted(distances) or any(r <= 0.0 or r > 1.0 for r in ratios):
+        fail(model_path + ": LOD distances must increase and ratios must be in (0, 1]")
+
+    with open(model_path) as f:
+        model_text = strip_comments(f.read())
+    with open(geo_path) as f:
+        geo_lines = f.read().split("\n")
+
+    arrays = find_arrays(model_text)
+    vtx_arrays = {}
+    for name, (qualifiers, kind, body) in arrays.items():
+        if kind == "Vtx":
+            vertices = parse_vtx(body)
+            if vertices is not None:
+                vtx_arrays[name] = vertices
+
+    referenced = set()
+    geo_text = strip_comments("\n".join(geo_lines))
+    for m in re.finditer(r"\b(\w+)\b", geo_text):
+        if m.group(1) in arrays and arrays[m.group(1)][1] == "Gfx":
+            referenced.add(m.group(1))
+
+    model_out = []
+    lods = {}
+    dl_qualifiers = {}
+    for name in sorted(referenced):
+        qualifiers, _, body = arrays[name]
+        items = parse_display_list(body, vtx_arrays)
+        if items is None:
+            continue
+        dl = DisplayList(name, qualifiers, items, vtx_arrays)
+        built = []
+        previous = len(dl.triangles)
+        for level, ratio in enumerate(ratios):
+            result = dl.build_lod(ratio, lod_name(name, level) + "_vtx")
+            if result is None or result[2] >= previous:
+                built.append(None)
+                continue
+            previous = result[2]
+            built.append(result)
+        if not any(built):
+            continue
+
+        lods[name] = [b is not None for b in built]
+        dl_qualifiers[name] = dl.qualifiers
+        for level, result in enumerate(built):
+            if result is None:
+                continue
+            vertices, commands, _ = result
+            lname = lod_name(name, level)
+            model_out.append("static const Vtx %s_vtx[] = {" % lname)
+            model_out.extend(format_vtx(v) for v in vertices)
+            model_out.append("};")
+            model_out.append("")
+            model_out.append("%sGfx %s[] = {" % (dl.qualifiers + " " if dl.qualifiers else "", lname))
+            model_out.extend("    %s," % c for c in commands)
+            model_out.append("};")
+            model_out.append("")
+
+    model_file, geo_file = output_paths(entry, build_dir)
+    header = "// Generated by tools/lod_generator.py from %s, do not edit\n\n"
+
+    geo_out = []
+    for name in sorted(lods):
+        for level, present in enumerate(lods[name]):
+            if present:
+                qualifiers = dl_qualifiers[name]
+                geo_out.append("extern %sGfx %s[];" % (qualifiers + " " if qualifiers else "",
+                                                      lod_name(name, level)))
+    if geo_out:
+        geo_out.append("")
+    geo_out.extend(rewrite_geo(geo_lines, lods, distances))
+
+    for path, source, lines in ((model_file, model_path, model_out), (geo_file, geo_path, geo_out)):
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        with open(path, "w") as f:
+            f.write(header % source)
+            f.write("\n".join(lines))
+            if lines and lines[-1] != "":
+                f.write("\n")
+
+
+def load_config(path):
+    with open(path) as f:
+        return json.load(f)
+
+
+def main():
+    args = sys.argv[1:]
+    if len(args) == 2 and args[0] == "--inputs":
+        for entry in load_config(args[1]):
+            print(entry["model"], entry["geo"])
+    elif len(args) == 3 and args[0] == "--outputs":
+        for entry in load_config(args[1]):
+            print(*output_paths(entry, args[2]))
+    elif len(args) == 2:
+        for entry in load_config(args[0]):
+            generate(entry, args[1])
+    else:
+        fail("usage: lod_generator.py [--inputs CONFIG | --outputs CONFIG BUILD_DIR | CONFIG BUILD_DIR]")
+
+
+if __name__ == "__main__":
+    main()